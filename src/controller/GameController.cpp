@@ -15,6 +15,7 @@
 #include "View.hpp"
 #include "cli/Cli.hpp"
 #include "explorer/Explorer.hpp"
+#include "format/Terminal.hpp"
 #include <iostream>
 #include <string>
 
@@ -54,11 +55,26 @@ void GameController::initialize(int argc_, char *argv_[]) {
    // Parse command-line arguments for checks and help.
    cli.addArgumentInteger('c', "checks", DEFAULT_CHECKS);
    cli.addArgument('h', "help");
+   cli.addArgument('a', "autosave");
+   cli.addArgument('d', "diff");
    cli.parse(argc_, argv_);
 
    // Set the 'm_help' flag based on the presence of the help option.
    m_help = cli.receiveSimple("-h");
 
+   // Start the background writer if autosave was requested.
+   if (cli.receiveSimple("-a")) {
+      ext::Explorer save{SAVE_FOLDER};
+      if (!save.exists()) {
+         ext::Explorer(".").createDirectory(save);
+      }
+
+      m_autosave.start(SAVE_FOLDER + '/' + AUTOSAVE_NAME + SAVE_EXTENSION);
+   }
+
+   // Redraw only what changes between frames, if the output is a terminal.
+   ext::Terminal::instance().differential(cli.receiveSimple("-d"));
+
    // Get the number of checks from the command line and set it with a minimum
    // check value.
    int checks{cli.receiveInteger("-c")};
@@ -202,6 +218,10 @@ void GameController::update() {
 
 /// @brief Render the game based on the current state.
 void GameController::render() {
+   // Everything drawn below makes up one frame.
+   ext::Terminal &terminal{ext::Terminal::instance()};
+   terminal.beginFrame();
+
    switch (m_state) {
    case Helper:
       renderHelper(DEFAULT_CHECKS);
@@ -249,6 +269,8 @@ void GameController::render() {
    default:
       break;
    }
+
+   terminal.endFrame();
 }
 
 /// @brief Check if the game should exit.
@@ -299,13 +321,14 @@ void GameController::selectData() {
 
 /// @brief Read and process a data file.
 void GameController::readData() {
-   // Read the data from the selected file and create a Bank object.
-   Bank bank{readBankFromFile(m_input_datas[m_select_data])};
+   // Map the selected file; the boards are read only when they are played.
+   if (!m_bank.open(m_input_datas[m_select_data])) {
+      return;
+   }
 
-   // Check if the read data is valid and can be used.
-   if (validateBank(bank)) {
-      // Update the game's bank with the valid data.
-      m_bank = bank;
+   // Start the first valid board, which also tells that the bank has one.
+   if (!startBoard(0)) {
+      m_bank.close();
    }
 }
 
@@ -335,31 +358,34 @@ void GameController::searchSaves() {
 /// @brief Read and process save files that match the current bank's ID and
 /// version.
 void GameController::readSaves() {
-   for (std::string local_save : m_input_saves) {
-      // Read a save file and create a Save object.
-      Save save{readGameFromFile(local_save)};
+   // Only the saves changed since the last run are read again, and only
+   // their headers.
+   SaveIndex save_index;
+   save_index.load(SAVE_FOLDER + '/' + SAVE_INDEX_NAME);
+   std::vector<SaveIndexEntry> entries{save_index.scan(m_input_saves)};
+
+   for (size_t index{0}; index != entries.size(); ++index) {
+      SaveIndexEntry const &entry{entries[index]};
 
       // Check if the save file matches the current bank's ID and version.
-      if (save.m_bank_id == m_bank.m_id &&
-          save.m_bank_version == m_bank.m_version) {
-         // Validate the save data.
-         if (validateSave(save)) {
-            // Add the valid save data to the game's list of saves.
-            std::pair<std::string, Save> save_pair{local_save, save};
-            m_saves.push_back(save_pair);
-         }
+      if (entry.m_valid && entry.m_bank_id == m_bank.id() &&
+          entry.m_bank_version == m_bank.version()) {
+         // The actions are read and validated when the save is selected.
+         Save save{entry.m_bank_id, entry.m_bank_version, entry.m_board_id,
+                   {}, 0};
+         m_saves.emplace_back(m_input_saves[index], save);
       }
    }
+
+   save_index.retain(m_input_saves);
+   save_index.store();
 }
 
 /// @brief Load a game from the current bank's boards and initialize it.
 void GameController::loadGame() {
-   // Set the selected game to the first game in the bank.
-   m_select_game = 0;
-
-   // Create a new Sudoku game using the board from the bank and the specified
-   // checks.
-   m_current_game = Sudoku{m_bank.m_boards[m_select_game], m_game_checks};
+   // readData() already started the first valid game of the bank while
+   // checking it; only clear what is left of a previous game.
+   m_play_message.clear();
 }
 /// @brief Get the user's menu option selection and update the menu option.
 void GameController::getOptionMenu() {
@@ -422,105 +448,132 @@ void GameController::getOptionPlay() {
 
    // Initialize variables.
    m_print_check = false;
-   ext::fstring full_command;
-   std::getline(std::cin, full_command);
-
-   // Trim leading and trailing whitespace from the input command.
-   full_command.trim();
+   std::getline(std::cin, m_command_line);
 
-   if (full_command.empty()) {
+   // A blank line goes back to the menu.
+   if (m_command_line.find_first_not_of(COMMAND_WHITESPACE) ==
+       std::string::npos) {
       m_return_menu = true;
-   } else {
-      // Split the input command into individual commands.
-      std::vector<std::string> commands;
-      full_command.split(commands, ' ');
-
-      // Get the first command from the input.
-      std::string command{commands.front()};
-
-      if (command == "p") {
-         // Insert a number into the game board.
-         insertNumber(commands);
-      } else if (command == "r") {
-         // Remove a number from the game board.
-         removeNumber(commands);
-      } else if (command == "c") {
-         // Check the game board for correctness.
-         checkBoard();
-      } else if (command == "u") {
-         // Undo the last move on the game board.
-         undoBoard();
-      } else {
-         // Handle unrecognized functions.
-         m_play_message = "No functions recognized.";
-      }
+      return;
    }
-}
 
-/// @brief Insert a number into the game board based on user input.
-/// @param commands_ A vector of input commands containing row, column, and
-/// number.
-void GameController::insertNumber(std::vector<std::string> commands_) {
-   if (commands_.size() >= 4) {
-      std::string row{commands_[1]};
-      std::string column{commands_[2]};
-      std::string number{commands_[3]};
+   // The commands are decoded in place, one after the other.
+   std::string_view line{m_command_line};
+   std::string_view command;
 
-      // Calculate the row integer from the row character.
-      int row_int{std::toupper(row.front()) - 'A' + 1};
-
-      try {
-         int column_int{std::stoi(column)};
-         int number_int{std::stoi(number)};
-
-         // Attempt to insert the number into the game board.
-         std::pair<bool, std::string> result{
-             m_current_game.insert(number_int, column_int, row_int)};
+   if (!nextCommand(line, command)) {
+      // Only separators were typed.
+      m_play_message = "No functions recognized.";
+      autosave();
+      return;
+   }
 
-         // Set the play message based on the insertion result.
-         m_play_message = result.second;
-      } catch (...) {
-         // Handle exceptions by indicating an incorrect entry format.
+   // A batch stops at the first command that fails, and its message tells
+   // the position of that command in the line.
+   std::string_view rest{line};
+   std::string_view next;
+   bool batch{nextCommand(rest, next)};
+   size_t position{0};
+   bool failed{false};
+
+   do {
+      PlayCommand play;
+      ++position;
+
+      switch (decodeCommand(command, play)) {
+      case CommandOk:
+         failed = !runCommand(play);
+         break;
+      case CommandUnknown:
+         // Handle unrecognized functions.
+         m_play_message = "No functions recognized.";
+         failed = true;
+         break;
+      case CommandShort:
+         // Handle cases where there are insufficient entries.
+         m_play_message = "Insufficient number of entries.";
+         failed = true;
+         break;
+      case CommandMalformed:
+         // Handle entries that are not numbers.
          m_play_message = "One of the entries is not in the requested format.";
+         failed = true;
+         break;
       }
-   } else {
-      // Handle cases where there are insufficient entries.
-      m_play_message = "Insufficient number of entries.";
+      // The rest of the line is dropped once the board is full.
+   } while (!failed && !m_current_game.checkFull() &&
+            nextCommand(line, command));
+
+   if (failed && batch) {
+      m_play_message =
+          "Command " + std::to_string(position) + ": " + m_play_message;
+   }
+
+   autosave();
+}
+
+/// @brief Run a decoded gameplay command.
+/// @param command_ The command.
+/// @return True if the command succeeded; otherwise, false.
+bool GameController::runCommand(PlayCommand const &command_) {
+   switch (command_.m_action) {
+   case PlayPlace:
+      // Insert a number into the game board.
+      return insertNumber(command_.m_row, command_.m_column, command_.m_number);
+   case PlayRemove:
+      // Remove a number from the game board.
+      return removeNumber(command_.m_row, command_.m_column);
+   case PlayCheck:
+      // Check the game board for correctness.
+      return checkBoard();
+   case PlayUndo:
+      // Undo the last move on the game board.
+      return undoBoard();
+   case PlayRedo:
+      // Redo the last undone move on the game board.
+      return redoBoard();
+   case PlayBranch:
+      // Switch the last move to another branch of the move tree.
+      return switchBranch();
    }
+
+   return false;
 }
 
-/// @brief Remove a number from the game board based on user input.
-/// @param commands_ A vector of input commands containing row and column.
-void GameController::removeNumber(std::vector<std::string> commands_) {
-   if (commands_.size() >= 3) {
-      std::string row{commands_[1]};
-      std::string column{commands_[2]};
+/// @brief Insert a number into the game board.
+/// @param row_ The row, from 1.
+/// @param column_ The column, from 1.
+/// @param number_ The number.
+/// @return True if the number was inserted; otherwise, false.
+bool GameController::insertNumber(int row_, int column_, int number_) {
+   // Attempt to insert the number into the game board.
+   std::pair<bool, std::string> result{
+       m_current_game.insert(number_, column_, row_)};
+
+   // Set the play message based on the insertion result.
+   m_play_message = result.second;
 
-      // Calculate the row integer from the row character.
-      int row_int{std::toupper(row.front()) - 'A' + 1};
+   return result.first;
+}
 
-      try {
-         int column_int{std::stoi(column)};
+/// @brief Remove a number from the game board.
+/// @param row_ The row, from 1.
+/// @param column_ The column, from 1.
+/// @return True if the number was removed; otherwise, false.
+bool GameController::removeNumber(int row_, int column_) {
+   // Attempt to remove the number from the game board.
+   std::pair<bool, std::string> result{m_current_game.remove(column_, row_)};
 
-         // Attempt to remove the number from the game board.
-         std::pair<bool, std::string> result{
-             m_current_game.remove(column_int, row_int)};
+   // Set the play message based on the removal result.
+   m_play_message = result.second;
 
-         // Set the play message based on the removal result.
-         m_play_message = result.second;
-      } catch (...) {
-         // Handle exceptions by indicating an incorrect entry format.
-         m_play_message = "One of the entries is not in the requested format.";
-      }
-   } else {
-      // Handle cases where there are insufficient entries.
-      m_play_message = "Insufficient number of entries.";
-   }
+   return result.first;
 }
 
 /// @brief Check the current game board for correctness and update play
 /// messages.
-void GameController::checkBoard() {
+/// @return True if the board was checked; otherwise, false.
+bool GameController::checkBoard() {
    // Check the current game board and get the result as a pair.
    std::pair<bool, std::string> result{m_current_game.check()};
 
@@ -530,16 +583,48 @@ void GameController::checkBoard() {
 
    // Set the play message based on the second value in the pair.
    m_play_message = result.second;
+
+   return result.first;
 }
 
 /// @brief Undo the last move on the current game board and update the play
 /// message.
-void GameController::undoBoard() {
+/// @return True if a move was undone; otherwise, false.
+bool GameController::undoBoard() {
    // Undo the last move on the current game board and get the result as a pair.
    std::pair<bool, std::string> result{m_current_game.undo()};
 
    // Set the play message based on the result.
    m_play_message = result.second;
+
+   return result.first;
+}
+
+/// @brief Redo the last undone move on the current game board and update the
+/// play message.
+/// @return True if a move was redone; otherwise, false.
+bool GameController::redoBoard() {
+   // Redo the last undone move on the current game board and get the result
+   // as a pair.
+   std::pair<bool, std::string> result{m_current_game.redo()};
+
+   // Set the play message based on the result.
+   m_play_message = result.second;
+
+   return result.first;
+}
+
+/// @brief Switch the last move on the current game board to another branch and
+/// update the play message.
+/// @return True if the branch was switched; otherwise, false.
+bool GameController::switchBranch() {
+   // Switch to the next branch of the move tree and get the result as a pair.
+   std::pair<bool, std::string> result{m_current_game.switchBranch()};
+
+   // Set the play message based on the result.
+   m_play_message = result.second;
+
+   return result.first;
 }
 
 /// @brief Start a new game, allowing the user to confirm or cancel.
@@ -572,19 +657,68 @@ void GameController::newGame() {
 
 /// @brief Generate a new game by selecting the next board in the bank.
 void GameController::generateNewGame() {
-   // Select the next game board in the bank (looping back to the first if
-   // necessary).
-   m_select_game = (m_select_game + 1) % m_bank.m_boards.size();
-
-   // Create a new Sudoku game using the selected board and the specified
-   // checks.
-   m_current_game = Sudoku{m_bank.m_boards[m_select_game], m_game_checks};
+   // Select the next valid game board in the bank (looping back to the first
+   // if necessary).
+   startBoard(m_select_game + 1);
 
    // Reset the new game flag and clear the play message.
    m_new_game = true;
    m_play_message.clear();
 }
 
+/// @brief Start a game on the first valid board from a position on.
+/// @param index_ The position of the first board to try.
+/// @return True if a valid board was found; otherwise, false.
+bool GameController::startBoard(size_t index_) {
+   for (size_t tries{0}; tries != m_bank.size(); ++tries) {
+      size_t index{(index_ + tries) % m_bank.size()};
+
+      // Validate the board only now that it is about to be played.
+      Board board{m_bank[index]};
+
+      if (::checkBoard(board)) {
+         m_select_game = static_cast<int>(index);
+         m_current_game = Sudoku{board, m_game_checks};
+         return true;
+      }
+   }
+
+   return false;
+}
+
+/// @brief Resume a save on its board, found in the bank by its id.
+/// @param save_ The save to resume.
+/// @return True if the board exists and is valid; otherwise, false.
+bool GameController::resumeSave(Save const &save_) {
+   std::pair<bool, size_t> position{m_bank.indexOf(save_.m_board_id)};
+
+   if (!position.first) {
+      return false;
+   }
+
+   Board board{m_bank[position.second]};
+
+   if (!::checkBoard(board)) {
+      return false;
+   }
+
+   m_select_game = static_cast<int>(position.second);
+   m_current_game = Sudoku{board, save_.m_checks, save_.m_actions};
+   return true;
+}
+
+/// @brief Read a save file and resume it, if it belongs to the current bank
+/// and its actions are valid.
+/// @param file_ The file name of the save.
+/// @return True if the save was resumed; otherwise, false.
+bool GameController::resumeSaveFile(std::string const &file_) {
+   Save save{readGameFromFile(file_)};
+
+   return save.m_bank_id == m_bank.id() &&
+          save.m_bank_version == m_bank.version() && validateSave(save) &&
+          resumeSave(save);
+}
+
 /// @brief Initiate the process of saving the current game with a user-specified
 /// name.
 void GameController::saveGame() {
@@ -636,22 +770,47 @@ void GameController::confirmOverwrite() {
    }
 }
 
-/// @brief Save the current game data to a file using the provided save
-/// information.
-void GameController::saveGameInFile() {
+/// @brief Take a snapshot of the current game.
+/// @return The save of the current game.
+Save GameController::currentSave() const {
    // Create a Save object to store game data.
    Save save;
 
    // Set the save object properties based on the current game state.
-   save.m_bank_id = m_bank.m_id;
-   save.m_bank_version = m_bank.m_version;
+   save.m_bank_id = m_bank.id();
+   save.m_bank_version = m_bank.version();
    save.m_board_id = m_current_game.getBoardId();
    save.m_checks = m_current_game.getChecks();
    save.m_actions = m_current_game.getActions();
 
-   // Save the game data to a file using the provided save information and file
-   // name.
-   saveGameToFile(save, m_saving_str);
+   return save;
+}
+
+/// @brief Hand a snapshot of the current game to the autosave writer.
+void GameController::autosave() {
+   // The writer coalesces the snapshots, so one is sent after every command.
+   if (m_autosave.isRunning()) {
+      m_autosave.submit(currentSave());
+   }
+}
+
+/// @brief Save the current game data to a file using the provided save
+/// information.
+void GameController::saveGameInFile() {
+   Save save{currentSave()};
+
+   // The autosave file belongs to the writer thread.
+   if (m_autosave.isRunning() && m_saving_str == m_autosave.file()) {
+      m_autosave.submit(save);
+      return;
+   }
+
+   // Saving again to the journal of this session appends only the changes;
+   // any other file gets a new journal.
+   if (!m_journal.isOpen() || m_journal.file() != m_saving_str ||
+       !m_journal.append(save)) {
+      m_journal.create(m_saving_str, save);
+   }
 }
 
 /// @brief Select and load a previously saved game based on user input.
@@ -662,12 +821,9 @@ void GameController::selectSave() {
       m_select_save = std::stoi(buffer);
 
       // Check if the selected save index is within valid bounds.
-      if (m_select_save >= 0 && m_select_save < m_saves.size()) {
-         // Load the selected save game data and update the current game state.
-         Save save{m_saves[m_select_save].second};
-         m_select_game = save.m_board_id;
-         m_current_game = Sudoku{m_bank.m_boards[save.m_board_id],
-                                 save.m_checks, save.m_actions};
+      if (m_select_save >= 0 && m_select_save < m_saves.size() &&
+          resumeSaveFile(m_saves[m_select_save].first)) {
+         // The selected save game data now holds the current game state.
          m_play_message.clear();
       } else if (m_select_save != m_saves.size()) {
          // If the selection is not within valid bounds, set the selection to
@@ -690,26 +846,12 @@ void GameController::enterLocalSave() {
 
    // Check if the save file exists and has the correct extension.
    if (save_file.exists() &&
-       save_file.extension().generic_string() == SAVE_EXTENSION) {
-      // Read the save data from the save file.
-      Save save{readGameFromFile(save_file.generic_string())};
-
-      // Check if the save data matches the current bank's ID and version.
-      if (save.m_bank_id == m_bank.m_id &&
-          save.m_bank_version == m_bank.m_version) {
-
-         // Validate the save data.
-         if (validateSave(save)) {
-            // Load the selected save game data and update the current game
-            // state.
-            m_select_game = save.m_board_id;
-            m_current_game = Sudoku{m_bank.m_boards[save.m_board_id],
-                                    save.m_checks, save.m_actions};
-            m_select_save = static_cast<size_t>(m_saves.size());
-            m_play_message.clear();
-            return;
-         }
-      }
+       save_file.extension().generic_string() == SAVE_EXTENSION &&
+       resumeSaveFile(save_file.generic_string())) {
+      // The selected save game data now holds the current game state.
+      m_select_save = static_cast<size_t>(m_saves.size());
+      m_play_message.clear();
+      return;
    }
 
    // If loading the game fails or the file is invalid, set the selection to -1.
@@ -801,7 +943,7 @@ void GameController::selectStateAfterSelectData() {
 /// bank.
 void GameController::selectStateAfterReadData() {
    // Check if the selected bank has no game boards or is empty.
-   if (m_bank.m_boards.empty()) {
+   if (m_bank.empty()) {
       // If the bank is empty or corrupt, transition to the Ending state with a
       // warning message.
       m_state = Ending;
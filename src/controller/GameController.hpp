@@ -16,7 +16,12 @@
 #ifndef GAME_CONTROLLER_HPP_
 #define GAME_CONTROLLER_HPP_
 
+#include "AutosaveWriter.hpp"
+#include "BankView.hpp"
+#include "PlayCommand.hpp"
 #include "Save.hpp"
+#include "SaveIndex.hpp"
+#include "SaveJournal.hpp"
 #include "Sudoku.hpp"
 #include <string>
 #include <vector>
@@ -51,6 +56,16 @@ std::string const SAVE_FOLDER{"./save"};
  */
 std::string const SAVE_EXTENSION{".sav"};
 
+/**
+ * @brief Name of the autosave file, inside the save folder.
+ */
+std::string const AUTOSAVE_NAME{"autosave"};
+
+/**
+ * @brief Name of the index of the saves, inside the save folder.
+ */
+std::string const SAVE_INDEX_NAME{"saves.idx"};
+
 /**
  * @brief Default confirmation character.
  */
@@ -130,11 +145,16 @@ class GameController {
    int m_select_game; ///< The selected game index.
    int m_select_save; ///< The selected save index.
 
-   Bank m_bank;           ///< An instance of the Bank class.
-   int m_game_checks;     ///< The number of game checks performed.
-   Sudoku m_current_game; ///< The current game state.
-   std::vector<std::pair<std::string, Save>> m_saves; ///< A list of save data.
+   BankView m_bank;           ///< The selected bank, mapped from its file.
+   SaveJournal m_journal;     ///< The journal of the last game saved.
+   AutosaveWriter m_autosave; ///< Background writer, if autosave is enabled.
+   int m_game_checks;         ///< The number of game checks performed.
+   Sudoku m_current_game;     ///< The current game state.
+   std::vector<std::pair<std::string, Save>>
+       m_saves; ///< The saves of the bank, without their actions.
    std::string m_play_message; ///< Message displayed during gameplay.
+   std::string m_command_line; ///< The last line of commands, kept so its
+                               ///< storage is reused by the next one.
 
    /**
     * @brief Private copy constructor, preventing copying of GameController
@@ -197,26 +217,65 @@ class GameController {
    void getOptionPlay();
 
    /**
-    * @brief Insert numbers into the game board based on user input.
-    * @param commands_ A vector of strings containing the user's commands.
+    * @brief Run a decoded gameplay command.
+    * @param command_ The command.
+    * @return True if the command succeeded; otherwise, false.
     */
-   void insertNumber(std::vector<std::string> commands_);
+   bool runCommand(PlayCommand const &command_);
 
    /**
-    * @brief Remove numbers from the game board based on user input.
-    * @param commands_ A vector of strings containing the user's commands.
+    * @brief Insert a number into the game board.
+    * @param row_ The row, from 1.
+    * @param column_ The column, from 1.
+    * @param number_ The number.
+    * @return True if the number was inserted; otherwise, false.
     */
-   void removeNumber(std::vector<std::string> commands_);
+   bool insertNumber(int row_, int column_, int number_);
+
+   /**
+    * @brief Remove a number from the game board.
+    * @param row_ The row, from 1.
+    * @param column_ The column, from 1.
+    * @return True if the number was removed; otherwise, false.
+    */
+   bool removeNumber(int row_, int column_);
 
    /**
     * @brief Check the current state of the game board.
+    * @return True if the board was checked; otherwise, false.
+    */
+   bool checkBoard();
+
+   /**
+    * @brief Take a snapshot of the current game.
+    * @return The save of the current game.
+    */
+   Save currentSave() const;
+
+   /**
+    * @brief Hand a snapshot of the current game to the autosave writer, if
+    * autosave is enabled.
     */
-   void checkBoard();
+   void autosave();
 
    /**
     * @brief Undo the last move on the game board.
+    * @return True if a move was undone; otherwise, false.
     */
-   void undoBoard();
+   bool undoBoard();
+
+   /**
+    * @brief Redo the last undone move on the game board.
+    * @return True if a move was redone; otherwise, false.
+    */
+   bool redoBoard();
+
+   /**
+    * @brief Replace the last move on the game board by another one played
+    * from the same position.
+    * @return True if the branch was switched; otherwise, false.
+    */
+   bool switchBranch();
 
    /**
     * @brief Start a new game.
@@ -228,6 +287,33 @@ class GameController {
     */
    void generateNewGame();
 
+   /**
+    * @brief Start a game on the first valid board from a position on.
+    *
+    * Boards are validated when they are loaded, so opening a bank does not
+    * have to read all of it; invalid boards are skipped.
+    *
+    * @param index_ The position of the first board to try.
+    * @return True if a valid board was found; otherwise, false.
+    */
+   bool startBoard(size_t index_);
+
+   /**
+    * @brief Resume a save on its board, found in the bank by its id.
+    * @param save_ The save to resume.
+    * @return True if the board exists and is valid; otherwise, false and the
+    * current game is left untouched.
+    */
+   bool resumeSave(Save const &save_);
+
+   /**
+    * @brief Read a save file and resume it, if it belongs to the current bank
+    * and its actions are valid.
+    * @param file_ The file name of the save.
+    * @return True if the save was resumed; otherwise, false.
+    */
+   bool resumeSaveFile(std::string const &file_);
+
    /**
     * @brief Save the current game state.
     */
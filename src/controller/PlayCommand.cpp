@@ -0,0 +1,118 @@
+/**
+ * @file PlayCommand.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the decoder of the commands typed while playing.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "PlayCommand.hpp"
+#include "format/fstring.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+
+/// @brief Reads a number from a word, as std::stoi does.
+/// @param word_ The word.
+/// @param value_ Receives the number.
+/// @return True if the word starts with a number that fits in an int;
+/// otherwise, false.
+static bool readNumber(std::string_view word_, int &value_) {
+   char const *first{word_.data()};
+   char const *last{first + word_.size()};
+
+   while (first != last && std::isspace(static_cast<unsigned char>(*first))) {
+      ++first;
+   }
+
+   // std::from_chars takes a '-' but not a '+'.
+   if (last - first >= 2 && *first == '+' &&
+       std::isdigit(static_cast<unsigned char>(first[1]))) {
+      ++first;
+   }
+
+   return std::from_chars(first, last, value_).ec == std::errc{};
+}
+
+/// @brief Takes the next command of a line, skipping empty ones.
+/// @param line_ The rest of the line.
+/// @param command_ Receives a view of the command.
+/// @return True if a command was taken; otherwise, false.
+bool nextCommand(std::string_view &line_, std::string_view &command_) {
+   while (!line_.empty()) {
+      size_t end{std::min(line_.find(COMMAND_SEPARATOR), line_.size())};
+      std::string_view command{line_.substr(0, end)};
+      line_.remove_prefix(std::min(end + 1, line_.size()));
+
+      size_t first{command.find_first_not_of(COMMAND_WHITESPACE)};
+
+      if (first != std::string_view::npos) {
+         size_t last{command.find_last_not_of(COMMAND_WHITESPACE)};
+         command_ = command.substr(first, last - first + 1);
+         return true;
+      }
+   }
+
+   return false;
+}
+
+/// @brief Decodes a command.
+/// @param command_ The command.
+/// @param play_ Receives the decoded command.
+/// @return CommandOk if the command was decoded; otherwise, the reason.
+CommandFault decodeCommand(std::string_view command_, PlayCommand &play_) {
+   std::string_view word;
+
+   if (!ext::next_token(command_, word) || word.size() != 1) {
+      return CommandUnknown;
+   }
+
+   size_t arguments{0};
+
+   switch (word.front()) {
+   case 'p':
+      play_.m_action = PlayPlace;
+      arguments = 3;
+      break;
+   case 'r':
+      play_.m_action = PlayRemove;
+      arguments = 2;
+      break;
+   case 'c':
+      play_.m_action = PlayCheck;
+      return CommandOk;
+   case 'u':
+      play_.m_action = PlayUndo;
+      return CommandOk;
+   case 'd':
+      play_.m_action = PlayRedo;
+      return CommandOk;
+   case 'b':
+      play_.m_action = PlayBranch;
+      return CommandOk;
+   default:
+      return CommandUnknown;
+   }
+
+   // All the arguments must be there before any is read.
+   std::string_view words[3];
+
+   for (size_t index{0}; index != arguments; ++index) {
+      if (!ext::next_token(command_, words[index])) {
+         return CommandShort;
+      }
+   }
+
+   play_.m_row =
+       std::toupper(static_cast<unsigned char>(words[0].front())) - 'A' + 1;
+   play_.m_number = 0;
+
+   if (!readNumber(words[1], play_.m_column) ||
+       (arguments == 3 && !readNumber(words[2], play_.m_number))) {
+      return CommandMalformed;
+   }
+
+   return CommandOk;
+}
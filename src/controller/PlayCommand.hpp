@@ -0,0 +1,89 @@
+/**
+ * @file PlayCommand.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares the decoder of the commands typed while playing.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * A line holds one command or several separated by ';', as in
+ * "p A 1 5; p B 2 3". Each command is a letter followed by its arguments,
+ * separated by spaces:
+ * - p <row> <col> <number>: place a number;
+ * - r <row> <col>: remove a number;
+ * - c, u, d, b: check, undo, redo and switch branch.
+ *
+ * The row is read from the first letter of its word, and the column and the
+ * number as std::stoi reads them (an optional sign, then digits; anything
+ * after is ignored). Extra words are ignored. Nothing is copied or allocated:
+ * the commands and their words are views of the line, and the numbers are
+ * read in place with std::from_chars.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLAY_COMMAND_HPP_
+#define PLAY_COMMAND_HPP_
+
+#include <string_view>
+
+/// Separates the commands of a line.
+constexpr char const COMMAND_SEPARATOR{';'};
+
+/// Whitespace trimmed around each command, as ext::fstring::trim does.
+constexpr std::string_view const COMMAND_WHITESPACE{" \t\n\r\f\v"};
+
+/**
+ * @enum PlayAction
+ * @brief Actions a command asks for.
+ */
+enum PlayAction {
+   PlayPlace,  ///< Place a number ('p').
+   PlayRemove, ///< Remove a number ('r').
+   PlayCheck,  ///< Check the moves ('c').
+   PlayUndo,   ///< Undo the last move ('u').
+   PlayRedo,   ///< Redo the last undone move ('d').
+   PlayBranch, ///< Switch the last move to another branch ('b').
+};
+
+/**
+ * @enum CommandFault
+ * @brief Reasons for a command not to be decoded.
+ */
+enum CommandFault {
+   CommandOk,        ///< The command was decoded.
+   CommandUnknown,   ///< The first word is not a command.
+   CommandShort,     ///< The command misses some arguments.
+   CommandMalformed, ///< The column or the number is not a number.
+};
+
+/**
+ * @struct PlayCommand
+ * @brief A decoded command.
+ */
+struct PlayCommand {
+   PlayAction m_action; ///< The action.
+   int m_row;           ///< The row, from 1 ('A'); for places and removes.
+   int m_column;        ///< The column; for places and removes.
+   int m_number;        ///< The number; for places only.
+};
+
+/**
+ * @brief Takes the next command of a line, skipping empty ones.
+ * @param line_ The rest of the line; moved past the command and its
+ * separator.
+ * @param command_ Receives a view of the command, without surrounding
+ * whitespace.
+ * @return True if a command was taken; false if none was left.
+ */
+bool nextCommand(std::string_view &line_, std::string_view &command_);
+
+/**
+ * @brief Decodes a command.
+ * @param command_ The command, as given by nextCommand().
+ * @param play_ Receives the decoded command.
+ * @return CommandOk if the command was decoded; otherwise, the reason.
+ */
+CommandFault decodeCommand(std::string_view command_, PlayCommand &play_);
+
+#endif /// PLAY_COMMAND_HPP_
@@ -8,7 +8,10 @@
  * @copyright Copyright (c) 2023
  *
  * @details
- * This file format is a binary format that contains the following data:
+ * The bank is saved in the packed layout (version 2, see BankFormat.hpp),
+ * which starts with the magic "SDK2" and stores each board in 56 bytes. The
+ * raw layout (version 1) is still read everywhere; it is a binary format that
+ * contains the following data:
  * - id (int): The identifier of the Sudoku bank.
  * - version (int): The version of the Sudoku bank.
  * - Quantity of boards (int): The number of Sudoku boards in the bank.
@@ -20,14 +23,24 @@
  *     };
  */
 
+#include "BankWriter.hpp"
+#include "Solver.hpp"
 #include "Sudoku.hpp"
 #include "Validate.hpp"
 #include "cli/Cli.hpp"
+#include "explorer/MappedFile.hpp"
+#include "parallel/WorkStealingPool.hpp"
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 /**
  * @brief The filename for saving and loading Sudoku bank data.
  *
@@ -49,14 +62,56 @@ std::string const FILENAME{"data.sdk"};
 Board getBoard(std::ifstream &input_file_);
 
 /**
- * @brief Reads multiple Sudoku boards from an input file.
+ * @brief Approximate size in bytes of the chunks parsed by each task of the
+ * parallel mode.
+ */
+constexpr size_t const CHUNK_SIZE{1 << 20};
+
+/**
+ * @brief Checks whether a character separates values, like std::ws does.
+ * @param char_ The character to check.
+ * @return True if the character is a whitespace; otherwise, false.
+ */
+bool isSpace(char char_);
+
+/**
+ * @brief Counts the whitespace-separated values of a piece of text.
+ * @param begin_ The first character of the text.
+ * @param end_ One past the last character of the text.
+ * @return The number of values.
+ */
+size_t countValues(char const *begin_, char const *end_);
+
+/**
+ * @brief Reads a Sudoku board from text with a hand-rolled integer scanner.
+ *
+ * @param cursor_ Position in the text; moved past the values read.
+ * @param end_ One past the last character of the text.
+ * @param board_ Receives the values read.
+ * @return True if all the values of a board were read; otherwise, false.
+ */
+bool scanBoard(char const *&cursor_, char const *end_, Board &board_);
+
+/**
+ * @brief Saves a board to the bank, creating the bank file with the first one.
  *
- * This function reads multiple Sudoku boards from the provided input file.
+ * @param writer_ The writer of the bank.
+ * @param board_ The board; receives the next id.
+ * @param id_ The id of the next board; incremented once the board is saved.
+ * @param bank_id_ The bank's identifier.
+ * @param version_ The bank's version.
+ * @return True if the board was saved; otherwise, false.
+ */
+bool saveBoard(BankWriter &writer_, Board &board_, int &id_, int bank_id_,
+               int version_);
+
+/**
+ * @brief Closes the bank and tells whether the file was converted.
  *
- * @param input_file_ The path to the input file.
- * @return A vector of parsed Sudoku boards.
+ * @param writer_ The writer of the bank; the file is not converted if it was
+ * never opened or if a write failed.
  */
-std::vector<Board> getBoards(std::string input_file_);
+void finishBank(BankWriter &writer_);
 
 /**
  * @brief Processes an input file, converts it to a Sudoku bank, and saves it to
@@ -71,6 +126,74 @@ std::vector<Board> getBoards(std::string input_file_);
  */
 void processFile(int id_, int version_, std::string input_file_);
 
+/**
+ * @brief Converts an input file to a Sudoku bank using several threads.
+ *
+ * The input is mapped and cut in chunks of about CHUNK_SIZE bytes at
+ * whitespace. The threads first count the values of each chunk, which tells
+ * where the first board starting in each chunk lies, then parse and validate
+ * the chunks, a window at a time. The boards are numbered and saved in input
+ * order, stopping at the first invalid board like processFile().
+ *
+ * @param id_ The bank's identifier.
+ * @param version_ The bank's version.
+ * @param input_file_ The path to the input file.
+ * @param threads_ The number of threads.
+ */
+void processFileParallel(int id_, int version_, std::string input_file_,
+                         unsigned threads_);
+
+/**
+ * @brief Checks whether a file uses the one-line format: each board as a line
+ * of 81 characters, '1' to '9' for givens and '.' or '0' for blanks.
+ * @param input_file_ The path to the input file.
+ * @return True if the first line that is not a comment holds a board line;
+ * otherwise, false.
+ */
+bool isLineFile(std::string const &input_file_);
+
+/**
+ * @brief Decodes the 81 characters of a board line, 16 at a time when SSE2
+ * is available.
+ * @param line_ The first character; 81 characters must be readable.
+ * @param cells_ Receives the digit of each cell, 0 for blanks.
+ * @return True if every character is a digit or '.'; otherwise, false.
+ */
+bool decodeLine(char const *line_, unsigned char *cells_);
+
+/**
+ * @brief Parses the board lines of a piece of text.
+ *
+ * A puzzle line may be followed, on the same line or on the next one, by its
+ * solution: 81 digits without blanks that agree with the givens. Puzzles
+ * without a solution are solved, and only kept if the solution is unique.
+ * Lines that hold no valid board are skipped.
+ *
+ * @param begin_ The first character of the text, at the start of a line.
+ * @param end_ One past the last character of the text.
+ * @param solver_ The solver used to fill in the hidden cells.
+ * @param boards_ Receives the valid boards, without ids.
+ * @return The number of lines skipped.
+ */
+size_t parseLines(char const *begin_, char const *end_, Solver &solver_,
+                  std::vector<Board> &boards_);
+
+/**
+ * @brief Converts a file in the one-line format to a Sudoku bank.
+ *
+ * The input is mapped and cut in chunks of about CHUNK_SIZE bytes at line
+ * breaks, never right before a line without blanks, which may be the solution
+ * of the previous line. The chunks are parsed a window at a time on the
+ * threads, and the boards are numbered and saved in input order.
+ *
+ * @param id_ The bank's identifier.
+ * @param version_ The bank's version.
+ * @param input_file_ The path to the input file.
+ * @param threads_ The number of threads.
+ */
+void processLineFile(int id_, int version_, std::string input_file_,
+                     unsigned threads_);
+
 /**
  * @brief The main function of the Sudoku bank converter.
  *
@@ -87,6 +210,7 @@ int main(int argc, char *argv[]) {
    cli.addArgumentInteger('i', "id");
    cli.addArgumentInteger('v', "version");
    cli.addArgumentInFile('d', "data");
+   cli.addArgumentInteger('j', "jobs");
 
    // Parse command-line arguments
    cli.parse(argc, argv);
@@ -94,6 +218,7 @@ int main(int argc, char *argv[]) {
    int id{cli.receiveInteger("-i")};
    int version{cli.receiveInteger("-v")};
    std::string input_file{cli.receiveInFile("-d")};
+   int jobs{cli.receiveInteger("-j")};
 
    // Check if required parameters are provided
    if (id == int() || input_file == std::string()) {
@@ -101,7 +226,15 @@ int main(int argc, char *argv[]) {
    }
 
    // Process the input file and create a Sudoku bank
-   processFile(id, version, input_file);
+   if (isLineFile(input_file)) {
+      processLineFile(id, version, input_file,
+                      static_cast<unsigned>(std::max(jobs, 1)));
+   } else if (jobs > 0) {
+      processFileParallel(id, version, input_file,
+                          static_cast<unsigned>(jobs));
+   } else {
+      processFile(id, version, input_file);
+   }
 
    return 0;
 }
@@ -128,45 +261,484 @@ Board getBoard(std::ifstream &input_file_) {
    return board;
 }
 
-/// @brief Reads multiple Sudoku boards from an input file.
+/// @brief Saves a board to the bank, creating the bank file with the first
+/// one.
+bool saveBoard(BankWriter &writer_, Board &board_, int &id_, int bank_id_,
+               int version_) {
+   // Create the bank file once there is a board to save.
+   if (!writer_.isOpen() &&
+       !writer_.open(FILENAME, bank_id_, version_, BankPacked)) {
+      return false;
+   }
+
+   board_.m_id = id_;
+
+   if (!writer_.append(board_)) {
+      return false;
+   }
+
+   ++id_;
+   return true;
+}
+
+/// @brief Closes the bank and tells whether the file was converted.
+void finishBank(BankWriter &writer_) {
+   if (!writer_.isOpen() || !writer_.close()) {
+      std::cout << " >>> File not converted!\n";
+      return;
+   }
+
+   std::cout << " >>> File converted!\n";
+}
+
+/// @brief Processes an input file, converts it to a Sudoku bank, and saves it
+/// to a file.
+void processFile(int id_, int version_, std::string input_file_) {
+   std::cout << " >>> Converting file...\n";
 
-std::vector<Board> getBoards(std::string input_file_) {
-   std::vector<Board> boards;
    std::ifstream file{input_file_};
+   BankWriter writer;
 
    int id{0};
 
+   // Stream each board to the bank as soon as it is read, so only one board
+   // is held in memory.
    while (true) {
-      // Read a Sudoku board and set its ID
+      // Read a Sudoku board and save it with the next ID
       Board board = getBoard(file);
-      board.m_id = id;
+      if (!checkBoard(board) || !saveBoard(writer, board, id, id_, version_)) {
+         break;
+      }
+   }
+
+   // Save the Sudoku bank to a file
+   finishBank(writer);
+}
+
+/// @brief Checks whether a character separates values, like std::ws does.
+bool isSpace(char char_) {
+   return char_ == ' ' || (char_ >= '\t' && char_ <= '\r');
+}
+
+/// @brief Counts the whitespace-separated values of a piece of text.
+size_t countValues(char const *begin_, char const *end_) {
+   size_t count{0};
+   bool in_value{false};
+
+   for (char const *cursor{begin_}; cursor != end_; ++cursor) {
+      bool space{isSpace(*cursor)};
+      count += !space && !in_value;
+      in_value = !space;
+   }
+
+   return count;
+}
+
+/// @brief Reads a Sudoku board from text with a hand-rolled integer scanner.
+bool scanBoard(char const *&cursor_, char const *end_, Board &board_) {
+   int *values{&board_.m_values[0][0]};
+
+   for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+      while (cursor_ != end_ && isSpace(*cursor_)) {
+         ++cursor_;
+      }
+
+      bool negative{false};
+
+      if (cursor_ != end_ && (*cursor_ == '-' || *cursor_ == '+')) {
+         negative = *cursor_ == '-';
+         ++cursor_;
+      }
+
+      if (cursor_ == end_ || *cursor_ < '0' || *cursor_ > '9') {
+         return false; // Missing or malformed value.
+      }
+
+      int value{0};
+
+      while (cursor_ != end_ && *cursor_ >= '0' && *cursor_ <= '9') {
+         // Saturate: anything above 9 is rejected by the validation anyway.
+         value = std::min(value * 10 + (*cursor_ - '0'), 100);
+         ++cursor_;
+      }
+
+      if (cursor_ != end_ && !isSpace(*cursor_)) {
+         return false; // Value followed by garbage.
+      }
+
+      values[cell] = negative ? -value : value;
+   }
+
+   return true;
+}
+
+/// @brief Converts an input file to a Sudoku bank using several threads.
+void processFileParallel(int id_, int version_, std::string input_file_,
+                         unsigned threads_) {
+   std::cout << " >>> Converting file...\n";
+
+   ext::MappedFile input;
+
+   if (!input.open(input_file_)) {
+      std::cout << " >>> File not converted!\n";
+      return;
+   }
+
+   ext::WorkStealingPool pool{threads_};
+   char const *text{input.data()};
+   size_t size{input.size()};
+
+   // Cut the text in chunks that end at a whitespace, so no value is split.
+   std::vector<size_t> bounds{0};
+
+   while (bounds.back() != size) {
+      size_t bound{std::min(size, bounds.back() + CHUNK_SIZE)};
+
+      while (bound != size && !isSpace(text[bound])) {
+         ++bound;
+      }
+
+      bounds.push_back(bound);
+   }
+
+   size_t chunks{bounds.size() - 1};
+
+   // Count the values of each chunk in parallel; their sums give the index
+   // of the first value of each chunk.
+   std::vector<size_t> first_value(chunks + 1, 0);
+
+   pool.run(
+       chunks,
+       [&](size_t chunk_, unsigned) {
+          first_value[chunk_ + 1] =
+              countValues(text + bounds[chunk_], text + bounds[chunk_ + 1]);
+       },
+       1);
+
+   for (size_t chunk{0}; chunk != chunks; ++chunk) {
+      first_value[chunk + 1] += first_value[chunk];
+   }
+
+   // Each chunk parses the boards that start among its values; the last one
+   // may end in the next chunk. Only a window of chunks is kept in memory.
+   size_t window{pool.size() * 4};
+   std::vector<std::vector<Board>> boards(window);
+   std::vector<std::vector<unsigned char>> valid(window);
+   BankWriter writer;
+   int id{0};
+   bool stop{false};
+
+   for (size_t first_chunk{0}; first_chunk < chunks && !stop;
+        first_chunk += window) {
+      size_t window_chunks{std::min(window, chunks - first_chunk)};
+
+      pool.run(
+          window_chunks,
+          [&](size_t slot_, unsigned) {
+             size_t chunk{first_chunk + slot_};
+             size_t first_board{(first_value[chunk] + CELLS_COUNT - 1) /
+                                CELLS_COUNT};
+             size_t end_board{(first_value[chunk + 1] + CELLS_COUNT - 1) /
+                              CELLS_COUNT};
+             char const *cursor{text + bounds[chunk]};
+             char const *end{text + size};
+
+             boards[slot_].assign(end_board - first_board, Board{});
+             valid[slot_].assign(end_board - first_board, 0);
+
+             // Skip the values of the board that started in a previous chunk.
+             for (size_t value{first_value[chunk]};
+                  first_board != end_board &&
+                  value != first_board * CELLS_COUNT;
+                  ++value) {
+                while (cursor != end && isSpace(*cursor)) {
+                   ++cursor;
+                }
+
+                while (cursor != end && !isSpace(*cursor)) {
+                   ++cursor;
+                }
+             }
+
+             for (size_t board{0}; board != boards[slot_].size(); ++board) {
+                valid[slot_][board] =
+                    scanBoard(cursor, end, boards[slot_][board]) &&
+                    checkBoard(boards[slot_][board]);
+             }
+          },
+          1);
+
+      // Number and save the boards in input order.
+      for (size_t slot{0}; slot != window_chunks && !stop; ++slot) {
+         for (size_t board{0}; board != boards[slot].size(); ++board) {
+            if (!valid[slot][board]) {
+               stop = true;
+               break;
+            }
+
+            if (!saveBoard(writer, boards[slot][board], id, id_, version_)) {
+               stop = true;
+               break;
+            }
+         }
+      }
+   }
+
+   // Save the Sudoku bank to a file
+   finishBank(writer);
+}
+
+/// @brief Checks whether a file uses the one-line format.
+bool isLineFile(std::string const &input_file_) {
+   std::ifstream file{input_file_};
+   std::string line;
+
+   while (std::getline(file, line)) {
+      if (line.empty() || line[0] == '#') {
+         continue;
+      }
+
+      unsigned char cells[CELLS_COUNT];
+      return line.size() >= CELLS_COUNT && decodeLine(line.data(), cells);
+   }
+
+   return false;
+}
+
+/// @brief Decodes the 81 characters of a board line.
+bool decodeLine(char const *line_, unsigned char *cells_) {
+   int cell{0};
+   bool valid{true};
+
+#if defined(__SSE2__)
+   __m128i const dot{_mm_set1_epi8('.')};
+   __m128i const zero_char{_mm_set1_epi8('0')};
+   __m128i const nine{_mm_set1_epi8(9)};
+   __m128i const zero{_mm_setzero_si128()};
+   int invalid{0};
+
+   for (; cell + 16 <= CELLS_COUNT; cell += 16) {
+      __m128i chars{
+          _mm_loadu_si128(reinterpret_cast<__m128i const *>(line_ + cell))};
+
+      // Blanks ('.') become 0; any other character must be a digit.
+      __m128i digits{_mm_andnot_si128(_mm_cmpeq_epi8(chars, dot),
+                                      _mm_sub_epi8(chars, zero_char))};
+      invalid |= _mm_movemask_epi8(_mm_or_si128(_mm_cmplt_epi8(digits, zero),
+                                                _mm_cmpgt_epi8(digits, nine)));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(cells_ + cell), digits);
+   }
+
+   valid = invalid == 0;
+#endif
+
+   // Decode the remaining characters one at a time.
+   for (; cell != CELLS_COUNT; ++cell) {
+      char character{line_[cell]};
+
+      if (character == '.') {
+         cells_[cell] = 0;
+      } else if (character >= '0' && character <= '9') {
+         cells_[cell] = static_cast<unsigned char>(character - '0');
+      } else {
+         valid = false;
+      }
+   }
+
+   return valid;
+}
+
+/// @brief Gets the end of the line that starts at a position.
+/// @param line_ The first character of the line.
+/// @param end_ One past the last character of the text.
+/// @return The position of the line break, or end_.
+static char const *lineEnd(char const *line_, char const *end_) {
+   void const *found{std::memchr(line_, '\n', end_ - line_)};
+   return found != nullptr ? static_cast<char const *>(found) : end_;
+}
+
+/// @brief Checks whether decoded cells form a solution of a puzzle.
+/// @param puzzle_ The cells of the puzzle, 0 for blanks.
+/// @param solution_ The cells of the candidate solution.
+/// @return True if the solution has no blanks and keeps every given.
+static bool isSolutionOf(unsigned char const *puzzle_,
+                         unsigned char const *solution_) {
+   for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+      if (solution_[cell] == 0 ||
+          (puzzle_[cell] != 0 && puzzle_[cell] != solution_[cell])) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+/// @brief Parses the board lines of a piece of text.
+size_t parseLines(char const *begin_, char const *end_, Solver &solver_,
+                  std::vector<Board> &boards_) {
+   size_t skipped{0};
+   char const *line{begin_};
+
+   while (line < end_) {
+      char const *line_end{lineEnd(line, end_)};
+      char const *next{line_end + (line_end != end_)};
+
+      // Blank lines and comments are not boards.
+      if (line == line_end || *line == '\r' || *line == '#') {
+         line = next;
+         continue;
+      }
+
+      unsigned char puzzle[CELLS_COUNT];
+      unsigned char solution[CELLS_COUNT];
+      bool has_solution{false};
+
+      if (line_end - line < CELLS_COUNT || !decodeLine(line, puzzle)) {
+         ++skipped;
+         line = next;
+         continue;
+      }
+
+      // A solution may follow on the same line, after a separator.
+      char const *rest{line + CELLS_COUNT};
+      while (rest != line_end && std::strchr(" \t,;:|", *rest) != nullptr) {
+         ++rest;
+      }
+
+      if (line_end - rest >= CELLS_COUNT && decodeLine(rest, solution) &&
+          isSolutionOf(puzzle, solution)) {
+         has_solution = true;
+      } else if (end_ - next >= CELLS_COUNT && decodeLine(next, solution) &&
+                 isSolutionOf(puzzle, solution)) {
+         // Or on the next line, which then belongs to this board.
+         has_solution = true;
+         line_end = lineEnd(next, end_);
+         next = line_end + (line_end != end_);
+      }
+
+      Board board{0, {{0}}};
+      int *values{&board.m_values[0][0]};
+
+      for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+         values[cell] = puzzle[cell];
+      }
+
+      if (!has_solution) {
+         // Fill in the hidden cells, keeping only puzzles with one solution.
+         // A single search stops at a second solution and keeps the first.
+         Board solved{board};
+
+         if (solver_.countSolutions(board, 2, &solved) != 1) {
+            ++skipped;
+            line = next;
+            continue;
+         }
+
+         board = solved;
+      } else {
+         for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+            if (puzzle[cell] == 0) {
+               values[cell] = -solution[cell];
+            }
+         }
+      }
+
       if (checkBoard(board)) {
-         boards.push_back(board);
-         ++id;
+         boards_.push_back(board);
       } else {
-         break;
+         ++skipped;
       }
+
+      line = next;
    }
 
-   return boards;
+   return skipped;
 }
 
-/// @brief Processes an input file, converts it to a Sudoku bank, and saves it
-/// to a file.
-void processFile(int id_, int version_, std::string input_file_) {
+/// @brief Converts a file in the one-line format to a Sudoku bank.
+void processLineFile(int id_, int version_, std::string input_file_,
+                     unsigned threads_) {
    std::cout << " >>> Converting file...\n";
 
-   Bank bank;
-   bank.m_id = id_;
-   bank.m_version = version_;
-   bank.m_boards = getBoards(input_file_);
+   ext::MappedFile input;
 
-   if (bank.m_boards.empty()) {
+   if (!input.open(input_file_)) {
       std::cout << " >>> File not converted!\n";
       return;
    }
 
+   ext::WorkStealingPool pool{threads_};
+   char const *text{input.data()};
+   char const *end{text + input.size()};
+
+   // Each thread solves with its own engine.
+   std::vector<std::unique_ptr<Solver>> solvers;
+   for (unsigned worker{0}; worker != pool.size(); ++worker) {
+      solvers.push_back(makeSolver(ENGINE_BITMASK));
+   }
+
+   // Cut the text at line breaks, but never before a line without blanks.
+   std::vector<char const *> bounds{text};
+
+   while (bounds.back() != end) {
+      char const *bound{
+          lineEnd(std::min(end, bounds.back() + CHUNK_SIZE), end)};
+      unsigned char cells[CELLS_COUNT];
+
+      while (bound != end) {
+         char const *line{bound + 1};
+
+         if (end - line < CELLS_COUNT || !decodeLine(line, cells) ||
+             std::find(cells, cells + CELLS_COUNT, 0) != cells + CELLS_COUNT) {
+            break;
+         }
+
+         bound = lineEnd(line, end);
+      }
+
+      bounds.push_back(bound == end ? end : bound + 1);
+   }
+
+   size_t chunks{bounds.size() - 1};
+   size_t window{pool.size() * 4};
+   std::vector<std::vector<Board>> boards(window);
+   std::vector<size_t> skipped(window, 0);
+   size_t total_skipped{0};
+   BankWriter writer;
+   int id{0};
+
+   for (size_t first_chunk{0}; first_chunk < chunks; first_chunk += window) {
+      size_t window_chunks{std::min(window, chunks - first_chunk)};
+
+      pool.run(
+          window_chunks,
+          [&](size_t slot_, unsigned worker_) {
+             size_t chunk{first_chunk + slot_};
+             boards[slot_].clear();
+             skipped[slot_] = parseLines(bounds[chunk], bounds[chunk + 1],
+                                         *solvers[worker_], boards[slot_]);
+          },
+          1);
+
+      // Number and save the boards in input order.
+      for (size_t slot{0}; slot != window_chunks; ++slot) {
+         total_skipped += skipped[slot];
+
+         for (Board &board : boards[slot]) {
+            // A failed write leaves the bank unconverted.
+            if (!saveBoard(writer, board, id, id_, version_)) {
+               finishBank(writer);
+               return;
+            }
+         }
+      }
+   }
+
+   if (total_skipped != 0) {
+      std::cout << " >>> Skipped lines: " << total_skipped << "\n";
+   }
+
    // Save the Sudoku bank to a file
-   saveBankToFile(bank, FILENAME);
-   std::cout << " >>> File converted!\n";
+   finishBank(writer);
 }
@@ -0,0 +1,77 @@
+/**
+ * @file Crc32.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief This file defines the CRC-32 checksum used to detect damaged data.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The checksum is the common CRC-32 (polynomial 0xEDB88320, reflected, as in
+ * zlib and PNG), computed a byte at a time from a table built at compile
+ * time. A checksum can be continued over several buffers by passing the
+ * previous result as the seed.
+ *
+ * Example:
+ * ```
+ * std::uint32_t crc = ext::crc32(header, sizeof(header));
+ * crc = ext::crc32(body, body_size, crc);
+ * ```
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CRC32_HPP_
+#define CRC32_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Namespace 'ext' for external utilities and extensions.
+ */
+namespace ext {
+/**
+ * @brief Builds the table of the checksum of every byte.
+ * @return The table, indexed by byte.
+ */
+constexpr std::array<std::uint32_t, 256> makeCrc32Table() {
+   std::array<std::uint32_t, 256> table{};
+
+   for (std::uint32_t byte{0}; byte != 256; ++byte) {
+      std::uint32_t crc{byte};
+
+      for (int bit{0}; bit != 8; ++bit) {
+         crc = (crc & 1u) != 0 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+      }
+
+      table[byte] = crc;
+   }
+
+   return table;
+}
+
+/// Checksum of every byte.
+constexpr std::array<std::uint32_t, 256> const CRC32_TABLE{makeCrc32Table()};
+
+/**
+ * @brief Computes the CRC-32 of a buffer.
+ * @param data_ The first byte of the buffer.
+ * @param size_ The size of the buffer in bytes.
+ * @param seed_ The checksum of the data before the buffer (0 to start).
+ * @return The checksum of the data up to the end of the buffer.
+ */
+inline std::uint32_t crc32(void const *data_, size_t size_,
+                           std::uint32_t seed_ = 0) {
+   unsigned char const *bytes{static_cast<unsigned char const *>(data_)};
+   std::uint32_t crc{~seed_};
+
+   for (size_t index{0}; index != size_; ++index) {
+      crc = CRC32_TABLE[(crc ^ bytes[index]) & 0xFFu] ^ (crc >> 8);
+   }
+
+   return ~crc;
+}
+} // namespace ext
+
+#endif /// CRC32_HPP_
@@ -0,0 +1,219 @@
+/**
+ * @file MappedFile.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief This file defines the MappedFile class, a read-only view of the
+ * contents of a file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * On POSIX systems the file is mapped into memory with mmap(), so opening is
+ * instant whatever the size of the file and pages are only read when they are
+ * touched. On other systems the whole file is read into a buffer instead.
+ *
+ * Example:
+ * ```
+ * ext::MappedFile file;
+ * if (file.open("data/basic.sdk")) {
+ *    char const *bytes = file.data();
+ *    size_t size = file.size();
+ * }
+ * ```
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MAPPED_FILE_HPP_
+#define MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define EXT_MAPPED_FILE_MMAP
+#endif
+
+/**
+ * @brief Namespace 'ext' for external utilities and extensions.
+ */
+namespace ext {
+/**
+ * @class MappedFile
+ * @brief A read-only, movable view of the bytes of a file.
+ */
+class MappedFile {
+ private:
+   char const *m_data{nullptr};      ///< First byte of the file.
+   size_t m_size{0};                 ///< Size of the file in bytes.
+   bool m_mapped{false};             ///< Whether m_data comes from mmap().
+   std::unique_ptr<char[]> m_buffer; ///< Copy of the file when not mapped.
+
+   /**
+    * @brief Reads the whole file into a buffer.
+    * @param file_ The file name.
+    * @return True if the file was read; otherwise, false.
+    */
+   bool readWhole(std::string const &file_) {
+      std::ifstream file{file_, std::ios::in | std::ios::binary};
+
+      if (!file.is_open()) {
+         return false;
+      }
+
+      file.seekg(0, std::ios::end);
+      std::streamoff size{file.tellg()};
+      file.seekg(0, std::ios::beg);
+
+      if (size < 0) {
+         return false;
+      }
+
+      m_buffer = std::make_unique<char[]>(static_cast<size_t>(size) + 1);
+
+      if (!file.read(m_buffer.get(), size)) {
+         m_buffer.reset();
+         return false;
+      }
+
+      m_data = m_buffer.get();
+      m_size = static_cast<size_t>(size);
+      return true;
+   }
+
+ public:
+   /**
+    * @brief Default constructor; the view starts closed.
+    */
+   MappedFile() = default;
+
+   /**
+    * @brief Deleted copy constructor; a mapping has a single owner.
+    */
+   MappedFile(MappedFile const &other_) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator.
+    */
+   MappedFile &operator=(MappedFile const &other_) = delete;
+
+   /**
+    * @brief Move constructor; the other view is left closed.
+    * @param other_ The view to move from.
+    */
+   MappedFile(MappedFile &&other_) noexcept { *this = std::move(other_); }
+
+   /**
+    * @brief Move assignment operator; the other view is left closed.
+    * @param other_ The view to move from.
+    * @return A reference to this view.
+    */
+   MappedFile &operator=(MappedFile &&other_) noexcept {
+      if (this != &other_) {
+         close();
+         m_data = std::exchange(other_.m_data, nullptr);
+         m_size = std::exchange(other_.m_size, 0);
+         m_mapped = std::exchange(other_.m_mapped, false);
+         m_buffer = std::move(other_.m_buffer);
+      }
+
+      return *this;
+   }
+
+   /**
+    * @brief Destructor; releases the mapping.
+    */
+   ~MappedFile() { close(); }
+
+   /**
+    * @brief Opens a file, closing the previous one.
+    * @param file_ The file name.
+    * @return True if the file was opened; otherwise, false.
+    */
+   bool open(std::string const &file_) {
+      close();
+
+#ifdef EXT_MAPPED_FILE_MMAP
+      int descriptor{::open(file_.c_str(), O_RDONLY)};
+
+      if (descriptor == -1) {
+         return false;
+      }
+
+      struct stat status;
+
+      if (::fstat(descriptor, &status) == -1) {
+         ::close(descriptor);
+         return false;
+      }
+
+      // Only regular files can be mapped; read anything else instead.
+      if (!S_ISREG(status.st_mode)) {
+         ::close(descriptor);
+         return readWhole(file_);
+      }
+
+      m_size = static_cast<size_t>(status.st_size);
+
+      // mmap() refuses empty files, which are still valid views.
+      if (m_size != 0) {
+         void *address{
+             ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0)};
+
+         if (address != MAP_FAILED) {
+            m_data = static_cast<char const *>(address);
+            m_mapped = true;
+         }
+      }
+
+      ::close(descriptor);
+
+      // Fall back to reading when the mapping fails.
+      if (m_size != 0 && !m_mapped) {
+         m_size = 0;
+         return readWhole(file_);
+      }
+
+      return true;
+#else
+      return readWhole(file_);
+#endif
+   }
+
+   /**
+    * @brief Closes the file, releasing the mapping or the buffer.
+    */
+   void close() {
+#ifdef EXT_MAPPED_FILE_MMAP
+      if (m_mapped) {
+         ::munmap(const_cast<char *>(m_data), m_size);
+      }
+#endif
+
+      m_buffer.reset();
+      m_data = nullptr;
+      m_size = 0;
+      m_mapped = false;
+   }
+
+   /**
+    * @brief Get the bytes of the file.
+    * @return A pointer to the first byte, or nullptr if nothing is open.
+    */
+   char const *data() const { return m_data; }
+
+   /**
+    * @brief Get the size of the file.
+    * @return The number of bytes of the file.
+    */
+   size_t size() const { return m_size; }
+};
+} // namespace ext
+
+#endif /// MAPPED_FILE_HPP_
@@ -0,0 +1,133 @@
+/**
+ * @file FrameBuffer.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief A fixed buffer that composes a frame of terminal output and writes it
+ * at once.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Printing a frame piece by piece costs a call (and, on an unbuffered
+ * terminal, a system call) per piece, and a styled ext::fstring allocates
+ * several strings per piece. A FrameBuffer instead copies the text and the
+ * ANSI escape sequences (see style.hpp) into a buffer of fixed size, and
+ * flush() hands the whole frame to the terminal in a single write. Nothing is
+ * allocated; a frame larger than the buffer is written in several parts.
+ * The frame goes through ext::Terminal, so it can also be drawn by
+ * differences.
+ *
+ * Styled text is written as ext::fstring::apply writes it: the prefix of the
+ * ext::Style, the text and its suffix.
+ *
+ * Example:
+ * ```
+ * ext::FrameBuffer<1024> frame;
+ * frame.append("Board ");
+ * frame.appendStyled("ok", ext::Style{ext::cfg::green});
+ * frame.append('\n');
+ * frame.flush();
+ * ```
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef FRAME_BUFFER_HPP_
+#define FRAME_BUFFER_HPP_
+
+#include "Terminal.hpp"
+#include "style.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+/**
+ * @brief Namespace 'ext' for external utilities and extensions.
+ */
+namespace ext {
+/**
+ * @class FrameBuffer
+ * @brief Composes terminal output in a fixed buffer and writes it at once.
+ * @tparam CAPACITY The size of the buffer in bytes.
+ */
+template <size_t CAPACITY> class FrameBuffer {
+ private:
+   std::array<char, CAPACITY> m_data; ///< The frame composed so far.
+   size_t m_size{0};                  ///< Bytes used in m_data.
+
+ public:
+   /**
+    * @brief Get the frame composed so far.
+    * @return A view of the bytes of the frame.
+    */
+   std::string_view view() const { return {m_data.data(), m_size}; }
+
+   /**
+    * @brief Forgets the frame composed so far.
+    */
+   void clear() { m_size = 0; }
+
+   /**
+    * @brief Appends a character.
+    * @param char_ The character.
+    */
+   void append(char char_) {
+      if (m_size == CAPACITY) {
+         flush();
+      }
+
+      m_data[m_size++] = char_;
+   }
+
+   /**
+    * @brief Appends text.
+    * @param text_ The text.
+    */
+   void append(std::string_view text_) {
+      while (!text_.empty()) {
+         if (m_size == CAPACITY) {
+            flush();
+         }
+
+         size_t count{std::min(text_.size(), CAPACITY - m_size)};
+         std::memcpy(m_data.data() + m_size, text_.data(), count);
+         m_size += count;
+         text_.remove_prefix(count);
+      }
+   }
+
+   /**
+    * @brief Appends a character repeated a number of times.
+    * @param count_ The number of times.
+    * @param char_ The character.
+    */
+   void append(size_t count_, char char_) {
+      for (size_t index{0}; index != count_; ++index) {
+         append(char_);
+      }
+   }
+
+   /**
+    * @brief Appends text in a style, as ext::fstring::apply does.
+    * @param text_ The text.
+    * @param style_ The style.
+    */
+   void appendStyled(std::string_view text_, Style const &style_) {
+      append(style_.prefix());
+      append(text_);
+      append(style_.suffix());
+   }
+
+   /**
+    * @brief Writes the frame to the terminal in a single write and clears it.
+    * @see Terminal::write
+    */
+   void flush() {
+      Terminal::instance().write(m_data.data(), m_size);
+      m_size = 0;
+   }
+};
+} // namespace ext
+
+#endif /// FRAME_BUFFER_HPP_
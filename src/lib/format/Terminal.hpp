@@ -0,0 +1,471 @@
+/**
+ * @file Terminal.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief The standard output of the program, drawn as a whole frame or by
+ * repainting only what changed from one frame to the next.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * By default the output goes straight to the terminal, and each frame scrolls
+ * the previous one away. In differential mode the terminal keeps the frame on
+ * screen instead: everything printed between beginFrame() and endFrame(),
+ * through std::cout or FrameBuffer, is captured, split into lines of cells (a
+ * character and the ANSI escape sequences it is drawn with), and compared with
+ * the frame on screen. Only the cells that changed are sent, each run of them
+ * after a cursor move, so redrawing a screen after a move costs tens of bytes
+ * instead of a few kilobytes.
+ *
+ * The frame must fit in the terminal, since the cursor can only reach the
+ * rows on screen: a frame taller than that is drawn whole, after clearing
+ * the screen. So is a frame with a line as wide as the terminal, since the
+ * terminal wraps it over more rows than the frame counts. The last line of a frame holds the prompt, where the user types
+ * and echoes input, so it is cleared after the prompt on the next frame.
+ *
+ * Example:
+ * ```
+ * ext::Terminal &terminal{ext::Terminal::instance()};
+ * terminal.differential(true);
+ * terminal.beginFrame();
+ * std::cout << "Board\n" << "Enter a command >> ";
+ * terminal.endFrame();
+ * ```
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef TERMINAL_HPP_
+#define TERMINAL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#define TERMINAL_POSIX
+#endif
+
+/**
+ * @brief Namespace 'ext' for external utilities and extensions.
+ */
+namespace ext {
+/// Rows assumed when the size of the terminal is unknown.
+constexpr int const TERMINAL_DEFAULT_ROWS{24};
+
+/// Columns assumed when the size of the terminal is unknown.
+constexpr int const TERMINAL_DEFAULT_COLUMNS{80};
+
+/**
+ * @class Terminal
+ * @brief The standard output, written at once and optionally by differences.
+ */
+class Terminal {
+ private:
+   /**
+    * @struct Cell
+    * @brief A character on the screen and how it is drawn.
+    */
+   struct Cell {
+      std::uint32_t m_bytes; ///< The bytes of the character (UTF-8), packed.
+      unsigned m_style;      ///< Its escape sequences, an index of m_styles.
+
+      bool operator==(Cell const &other_) const {
+         return m_bytes == other_.m_bytes && m_style == other_.m_style;
+      }
+
+      bool operator!=(Cell const &other_) const { return !(*this == other_); }
+   };
+
+   /// A line of the screen.
+   using Line = std::vector<Cell>;
+
+   bool m_differential{false}; ///< Whether frames are drawn by differences.
+   bool m_capturing{false};    ///< Whether a frame is being captured.
+   bool m_shown{false};        ///< Whether m_screen is what the screen shows.
+   std::stringbuf m_capture;   ///< The frame being captured.
+   std::streambuf *m_output{nullptr}; ///< The buffer of std::cout, while
+                                      ///< it is captured.
+   std::vector<Line> m_screen;        ///< The last frame drawn.
+
+   /// The escape sequences cells are drawn with; 0 is none.
+   std::vector<std::string> m_styles{std::string{}};
+   std::unordered_map<std::string, unsigned> m_style_ids{{std::string{}, 0}};
+
+   std::string m_out; ///< The bytes sent to the terminal for a frame.
+
+   /**
+    * @brief Private constructor; there is a single standard output.
+    */
+   Terminal() = default;
+
+   /**
+    * @brief Writes bytes to the standard output, in as few writes as it
+    * takes.
+    * @param data_ The first byte.
+    * @param size_ The number of bytes.
+    */
+   static void writeAll(char const *data_, size_t size_) {
+#if defined(TERMINAL_POSIX)
+      while (size_ != 0) {
+         ssize_t written{::write(STDOUT_FILENO, data_, size_)};
+
+         if (written < 0 && errno == EINTR) {
+            continue;
+         } else if (written <= 0) {
+            return; // The terminal is gone: drop the frame.
+         }
+
+         data_ += written;
+         size_ -= static_cast<size_t>(written);
+      }
+#else
+      std::cout.write(data_, static_cast<std::streamsize>(size_));
+      std::cout.flush();
+#endif
+   }
+
+   /**
+    * @brief Get the size of the terminal.
+    * @return A pair with the rows and the columns; TERMINAL_DEFAULT_ROWS and
+    * TERMINAL_DEFAULT_COLUMNS for the ones that are unknown.
+    */
+   static std::pair<int, int> windowSize() {
+      std::pair<int, int> window{TERMINAL_DEFAULT_ROWS,
+                                 TERMINAL_DEFAULT_COLUMNS};
+#if defined(TERMINAL_POSIX) && defined(TIOCGWINSZ)
+      winsize size{};
+
+      if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0) {
+         window.first = size.ws_row != 0 ? size.ws_row : window.first;
+         window.second = size.ws_col != 0 ? size.ws_col : window.second;
+      }
+#endif
+      return window;
+   }
+
+   /**
+    * @brief Get the index of some escape sequences, adding them if new.
+    * @param style_ The escape sequences.
+    * @return The index in m_styles.
+    */
+   unsigned styleId(std::string const &style_) {
+      auto found{m_style_ids.find(style_)};
+
+      if (found != m_style_ids.end()) {
+         return found->second;
+      }
+
+      unsigned id{static_cast<unsigned>(m_styles.size())};
+      m_styles.push_back(style_);
+      m_style_ids.emplace(style_, id);
+      return id;
+   }
+
+   /**
+    * @brief Splits a frame in lines of cells.
+    *
+    * Select Graphic Rendition sequences ("\33[...m") add to the style of the
+    * cells that follow, until one resets it ("\33[m" or "\33[0m"); other
+    * escape sequences are dropped.
+    *
+    * @param frame_ The frame.
+    * @return The lines of the frame.
+    */
+   std::vector<Line> parse(std::string_view frame_) {
+      std::vector<Line> lines(1);
+      std::string style;
+      size_t index{0};
+
+      while (index != frame_.size()) {
+         unsigned char byte{static_cast<unsigned char>(frame_[index])};
+
+         if (byte == '\33' && index + 1 != frame_.size() &&
+             frame_[index + 1] == '[') {
+            // The sequence ends at its first byte from '@' to '~'.
+            size_t end{index + 2};
+            while (end != frame_.size() &&
+                   (frame_[end] < '@' || frame_[end] > '~')) {
+               ++end;
+            }
+
+            if (end == frame_.size()) {
+               break;
+            }
+
+            if (frame_[end] == 'm') {
+               std::string_view codes{
+                   frame_.substr(index + 2, end - index - 2)};
+
+               if (codes.empty() || codes == "0") {
+                  style.clear();
+               } else {
+                  style.append(frame_.substr(index, end + 1 - index));
+               }
+            }
+
+            index = end + 1;
+         } else if (byte == '\n') {
+            lines.emplace_back();
+            ++index;
+         } else {
+            // A character takes one cell, with all its UTF-8 bytes.
+            size_t size{1};
+
+            if (byte >= 0xF0) {
+               size = 4;
+            } else if (byte >= 0xE0) {
+               size = 3;
+            } else if (byte >= 0xC0) {
+               size = 2;
+            }
+
+            size = std::min(size, frame_.size() - index);
+
+            std::uint32_t bytes{0};
+            for (size_t offset{0}; offset != size; ++offset) {
+               bytes |= static_cast<std::uint32_t>(static_cast<unsigned char>(
+                            frame_[index + offset]))
+                        << (8 * offset);
+            }
+
+            lines.back().push_back({bytes, styleId(style)});
+            index += size;
+         }
+      }
+
+      return lines;
+   }
+
+   /**
+    * @brief Appends the sequence that moves the cursor to a cell.
+    * @param row_ The row, counting from 1.
+    * @param column_ The column, counting from 1.
+    */
+   void appendMove(size_t row_, size_t column_) {
+      m_out += "\33[";
+      m_out += std::to_string(row_);
+      m_out += ';';
+      m_out += std::to_string(column_);
+      m_out += 'H';
+   }
+
+   /**
+    * @brief Appends cells of a line, with their styles, leaving no style
+    * active.
+    * @param line_ The line.
+    * @param begin_ The first cell.
+    * @param end_ One past the last cell.
+    */
+   void appendCells(Line const &line_, size_t begin_, size_t end_) {
+      unsigned style{0};
+
+      for (size_t index{begin_}; index != end_; ++index) {
+         Cell const &cell{line_[index]};
+
+         if (cell.m_style != style) {
+            if (style != 0) {
+               m_out += "\33[0m";
+            }
+
+            m_out += m_styles[cell.m_style];
+            style = cell.m_style;
+         }
+
+         for (std::uint32_t bytes{cell.m_bytes}; bytes != 0; bytes >>= 8) {
+            m_out += static_cast<char>(bytes & 0xFFu);
+         }
+      }
+
+      if (style != 0) {
+         m_out += "\33[0m";
+      }
+   }
+
+   /**
+    * @brief Appends what turns a line on screen into another.
+    * @param row_ The row of the line, counting from 1.
+    * @param before_ The line on screen.
+    * @param now_ The new line.
+    */
+   void appendLineDiff(size_t row_, Line const &before_, Line const &now_) {
+      size_t common{std::min(before_.size(), now_.size())};
+      size_t first{0};
+
+      while (first != common && before_[first] == now_[first]) {
+         ++first;
+      }
+
+      if (first == before_.size() && first == now_.size()) {
+         return; // The line did not change.
+      }
+
+      // Cells after the change stay in their columns only if the length is
+      // the same.
+      size_t end{now_.size()};
+
+      if (before_.size() == now_.size()) {
+         while (end != first && before_[end - 1] == now_[end - 1]) {
+            --end;
+         }
+      }
+
+      appendMove(row_, first + 1);
+      appendCells(now_, first, end);
+
+      if (now_.size() < before_.size()) {
+         m_out += "\33[K"; // Clear the rest of the old line.
+      }
+   }
+
+ public:
+   /**
+    * @brief Deleted copy constructor.
+    */
+   Terminal(Terminal const &other_) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator.
+    */
+   Terminal &operator=(Terminal const &other_) = delete;
+
+   /**
+    * @brief Get the terminal of the program.
+    * @return The single instance.
+    */
+   static Terminal &instance() {
+      static Terminal terminal;
+      return terminal;
+   }
+
+   /**
+    * @brief Turns the differential mode on or off.
+    * @param enable_ Whether frames should be drawn by differences.
+    * @return True if the mode is on; it stays off when the standard output is
+    * not a terminal.
+    */
+   bool differential(bool enable_) {
+#if defined(TERMINAL_POSIX)
+      m_differential = enable_ && isatty(STDOUT_FILENO) != 0;
+#else
+      m_differential = false;
+#endif
+      m_shown = false;
+      return m_differential;
+   }
+
+   /**
+    * @brief Check if frames are drawn by differences.
+    * @return True if the differential mode is on; otherwise, false.
+    */
+   bool isDifferential() const { return m_differential; }
+
+   /**
+    * @brief Starts capturing a frame, in differential mode.
+    */
+   void beginFrame() {
+      if (!m_differential || m_capturing) {
+         return;
+      }
+
+      std::cout.flush();
+      m_output = std::cout.rdbuf(&m_capture);
+      m_capturing = true;
+   }
+
+   /**
+    * @brief Draws the frame captured since beginFrame(), in a single write.
+    */
+   void endFrame() {
+      if (!m_capturing) {
+         return;
+      }
+
+      std::cout.rdbuf(m_output);
+      m_capturing = false;
+
+      std::string frame{m_capture.str()};
+      m_capture.str(std::string{});
+
+      std::vector<Line> screen{parse(frame)};
+      size_t height{screen.size()};
+      std::pair<int, int> window{windowSize()};
+      m_out.clear();
+
+      // Entering the input moves the cursor a row down: a frame that does
+      // not leave that row on screen scrolls, and must be drawn whole. A line
+      // the terminal wraps takes more rows than counted, so its frame is
+      // drawn whole as well.
+      bool fits{height < static_cast<size_t>(window.first) &&
+                std::none_of(screen.begin(), screen.end(),
+                             [&](Line const &line_) {
+                                return line_.size() >=
+                                       static_cast<size_t>(window.second);
+                             })};
+
+      if (!m_shown || !fits) {
+         m_out += "\33[H\33[2J";
+         m_out += frame;
+         m_shown = fits;
+      } else {
+         Line const empty;
+         size_t count{std::max(height, m_screen.size())};
+
+         for (size_t row{0}; row != count; ++row) {
+            if (row >= height) {
+               appendMove(row + 1, 1);
+               m_out += "\33[K";
+               continue;
+            }
+
+            appendLineDiff(row + 1,
+                           row < m_screen.size() ? m_screen[row] : empty,
+                           screen[row]);
+
+            // The input was echoed after the prompt on the last line.
+            if (row + 1 == m_screen.size()) {
+               appendMove(row + 1, screen[row].size() + 1);
+               m_out += "\33[K";
+            }
+         }
+
+         // Leave the cursor after the prompt, where the input is typed.
+         appendMove(height, screen.back().size() + 1);
+      }
+
+      m_screen = std::move(screen);
+      writeAll(m_out.data(), m_out.size());
+   }
+
+   /**
+    * @brief Writes bytes to the standard output in a single write, or to the
+    * frame being captured.
+    *
+    * What was printed through std::cout before is flushed first, to keep the
+    * output in order.
+    *
+    * @param data_ The first byte.
+    * @param size_ The number of bytes.
+    */
+   void write(char const *data_, size_t size_) {
+      if (m_capturing) {
+         m_capture.sputn(data_, static_cast<std::streamsize>(size_));
+         return;
+      }
+
+      std::cout.flush();
+      writeAll(data_, size_);
+   }
+};
+} // namespace ext
+
+#endif /// TERMINAL_HPP_
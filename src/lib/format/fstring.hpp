@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "style.hpp"
@@ -23,6 +24,72 @@
  */
 namespace ext {
 
+/**
+ * @brief Takes the next token of a text, skipping the delimiters before it.
+ *
+ * Nothing is copied or allocated, so a whole text is split in linear time:
+ * ```
+ * std::string_view rest{text}, token;
+ * while (ext::next_token(rest, token)) { ... }
+ * ```
+ *
+ * @tparam CharType The character type of the text.
+ * @param rest_ The text left; moved past the token.
+ * @param token_ Receives a view of the token.
+ * @param delimiter_ The character that separates tokens (default is a
+ * space).
+ * @return True if a token was taken; false if only delimiters were left.
+ */
+template <typename CharType>
+bool next_token(std::basic_string_view<CharType> &rest_,
+                std::basic_string_view<CharType> &token_,
+                CharType delimiter_ = ' ') {
+   size_t begin{rest_.find_first_not_of(delimiter_)};
+
+   if (begin == std::basic_string_view<CharType>::npos) {
+      rest_.remove_prefix(rest_.size());
+      return false;
+   }
+
+   size_t end{std::min(rest_.find(delimiter_, begin), rest_.size())};
+   token_ = rest_.substr(begin, end - begin);
+   rest_.remove_prefix(end);
+   return true;
+}
+
+/**
+ * @brief Takes the next field of a text, where every delimiter ends a field,
+ * so fields may be empty: a text with n delimiters has n + 1 fields.
+ *
+ * @tparam CharType The character type of the text.
+ * @param rest_ The text left; moved past the field and its delimiter, and
+ * left with no data once the last field is taken (so a default-constructed
+ * view has no fields, unlike an empty text).
+ * @param field_ Receives a view of the field.
+ * @param delimiter_ The character that ends fields (default is a space).
+ * @return True if a field was taken; false if none was left.
+ */
+template <typename CharType>
+bool next_field(std::basic_string_view<CharType> &rest_,
+                std::basic_string_view<CharType> &field_,
+                CharType delimiter_ = ' ') {
+   if (rest_.data() == nullptr) {
+      return false;
+   }
+
+   size_t end{rest_.find(delimiter_)};
+
+   if (end == std::basic_string_view<CharType>::npos) {
+      field_ = rest_;
+      rest_ = std::basic_string_view<CharType>{};
+      return true;
+   }
+
+   field_ = rest_.substr(0, end);
+   rest_.remove_prefix(end + 1);
+   return true;
+}
+
 /**
  * @brief A custom string class that extends std::basic_string.
  * @tparam CharType The character type used in the string (e.g., char, wchar_t).
@@ -209,14 +276,9 @@ class fstring : public std::basic_string<CharType> {
     * @return A new fstring representing the specified substring.
     */
    fstring sub_fstring(size_type last_, size_type first_ = 0) const {
-      std::ostringstream oss;
-
-      for (size_type index{first_}; index != last_; ++index) {
-         oss << (*this)[index];
-      }
-
-      return fstring(oss.str());
+      return fstring(*this, first_, last_ - first_);
    }
+
    /**
     * @brief Splits the fstring into substrings based on a specified delimiter
     * and stores them in a container.
@@ -228,19 +290,11 @@ class fstring : public std::basic_string<CharType> {
     */
    template <class Container>
    void split(Container &container_, CharType const &delimiter_ = ' ') const {
-      fstring buffer{*this};
-
-      size_type pos{buffer.find_first_not_of(delimiter_)};
+      std::basic_string_view<CharType> rest{*this};
+      std::basic_string_view<CharType> token;
 
-      while (pos != std::basic_string<CharType>::npos) {
-         size_type pos_delimiter{buffer.find_first_of(delimiter_, pos)};
-         if (pos_delimiter == std::basic_string<CharType>::npos) {
-            pos_delimiter = buffer.length();
-         }
-
-         container_.push_back(buffer.sub_fstring(pos_delimiter, pos));
-         buffer.erase(0, pos_delimiter);
-         pos = buffer.find_first_not_of(delimiter_);
+      while (next_token(rest, token, delimiter_)) {
+         container_.emplace_back(token.data(), token.size());
       }
    }
 
@@ -256,27 +310,53 @@ class fstring : public std::basic_string<CharType> {
    template <class Container>
    void split_with_empty(Container &container_,
                          CharType const &delimiter_ = ' ') const {
-      fstring buffer{*this};
+      std::basic_string_view<CharType> rest{*this};
+      std::basic_string_view<CharType> field;
 
-      bool additional_split{false};
-      if (buffer.find_last_of(delimiter_) == buffer.size() - 1) {
-         additional_split = true;
-      };
+      while (next_field(rest, field, delimiter_)) {
+         container_.emplace_back(field.data(), field.size());
+      }
+   }
 
-      size_type pos{buffer.find_first_of(delimiter_)};
+   /**
+    * @brief Splits the fstring like split(), storing views of the substrings
+    * instead of copies. The views stay valid while the fstring is unchanged.
+    *
+    * @tparam Container The type of container to store the views (e.g.,
+    * std::vector<std::string_view>); reusing it avoids any allocation.
+    * @param container_ The container to store the views.
+    * @param delimiter_ The character used as the delimiter (default is a
+    * space).
+    */
+   template <class Container>
+   void split_view(Container &container_,
+                   CharType const &delimiter_ = ' ') const {
+      std::basic_string_view<CharType> rest{*this};
+      std::basic_string_view<CharType> token;
 
-      while (pos != std::basic_string<CharType>::npos) {
-         container_.push_back(buffer.sub_fstring(pos));
-         buffer.erase(0, pos + 1);
-         pos = buffer.find_first_of(delimiter_);
+      while (next_token(rest, token, delimiter_)) {
+         container_.push_back(token);
       }
+   }
 
-      if (!buffer.empty()) {
-         container_.push_back(buffer);
-      }
+   /**
+    * @brief Splits the fstring like split_with_empty(), storing views of the
+    * substrings instead of copies. The views stay valid while the fstring is
+    * unchanged.
+    *
+    * @tparam Container The type of container to store the views.
+    * @param container_ The container to store the views.
+    * @param delimiter_ The character used as the delimiter (default is a
+    * space).
+    */
+   template <class Container>
+   void split_view_with_empty(Container &container_,
+                              CharType const &delimiter_ = ' ') const {
+      std::basic_string_view<CharType> rest{*this};
+      std::basic_string_view<CharType> field;
 
-      if (additional_split) {
-         container_.push_back(fstring());
+      while (next_field(rest, field, delimiter_)) {
+         container_.push_back(field);
       }
    }
 
@@ -467,25 +547,32 @@ class fstring : public std::basic_string<CharType> {
       *this = oss.str();
    }
    /**
-    * @brief Sets the text color for the fstring using ANSI color codes.
+    * @brief Applies a foreground color, a background color and a font style
+    * at once, inserting the prefix of the style before the fstring and
+    * appending its suffix, with at most one allocation.
     *
-    * @param code_ The ANSI color code to apply (default is cfg::none).
+    * @param style_ The style to apply.
     */
-   void color(short code_ = cfg::none) {
-      bool search{
-          std::any_of(std::begin(cfg::list), std::end(cfg::list),
-                      [code_](short color_) { return code_ == color_; })};
-
-      if (!search || code_ == cfg::none) {
+   void apply(Style const &style_) {
+      if (style_.empty()) {
          return;
       }
 
-      std::ostringstream oss;
+      std::string_view prefix{style_.prefix()};
+      std::string_view suffix{style_.suffix()};
 
-      oss << "\33[" << code_ << "m" << *this << "\33[" << stl::regular << "m";
-      *this = oss.str();
+      this->reserve(this->size() + prefix.size() + suffix.size());
+      this->insert(this->begin(), prefix.begin(), prefix.end());
+      this->insert(this->end(), suffix.begin(), suffix.end());
    }
 
+   /**
+    * @brief Sets the text color for the fstring using ANSI color codes.
+    *
+    * @param code_ The ANSI color code to apply (default is cfg::none).
+    */
+   void color(short code_ = cfg::none) { apply(Style{code_}); }
+
    /**
     * @brief Sets the background color for the fstring using ANSI color codes.
     *
@@ -493,18 +580,7 @@ class fstring : public std::basic_string<CharType> {
     * cbg::none).
     */
    void background(short code_ = cbg::none) {
-      bool search{std::any_of(
-          std::begin(cbg::list), std::end(cbg::list),
-          [code_](short background_) { return code_ == background_; })};
-
-      if (!search || code_ == cbg::none) {
-         return;
-      }
-
-      std::ostringstream oss;
-
-      oss << "\33[" << code_ << "m" << *this << "\33[" << stl::regular << "m";
-      *this = oss.str();
+      apply(Style{cfg::none, code_});
    }
 
    /**
@@ -513,18 +589,7 @@ class fstring : public std::basic_string<CharType> {
     * @param code_ The ANSI style code to apply (default is stl::none).
     */
    void style(short code_ = stl::none) {
-      bool search{
-          std::any_of(std::begin(stl::list), std::end(stl::list),
-                      [code_](short style_) { return code_ == style_; })};
-
-      if (!search || code_ == stl::none) {
-         return;
-      }
-
-      std::ostringstream oss;
-
-      oss << "\33[" << code_ << "m" << *this << "\33[" << stl::regular << "m";
-      *this = oss.str();
+      apply(Style{cfg::none, cbg::none, code_});
    }
 };
 } // namespace ext
@@ -16,6 +16,9 @@
 #ifndef STYLE_HPP_
 #define STYLE_HPP_
 
+#include <cstddef>
+#include <string_view>
+
 namespace ext {
 /**
  * @brief Foreground namespace
@@ -100,6 +103,124 @@ inline constexpr short const list[] = {
     none,   regular,          bold, faint, italic, underline, reverse, hide,
     strike, doubly_underlined}; ///< List of font styles
 } // namespace stl
+
+/**
+ * @brief Checks if a code is one of a list of ANSI codes, other than none.
+ * @tparam SIZE The size of the list.
+ * @param list_ The list, as cfg::list, cbg::list or stl::list.
+ * @param code_ The code.
+ * @return True if the code is in the list and is not none; otherwise, false.
+ */
+template <std::size_t SIZE>
+constexpr bool isAnsiCode(short const (&list_)[SIZE], short code_) {
+   if (code_ == cfg::none) {
+      return false;
+   }
+
+   for (short code : list_) {
+      if (code == code_) {
+         return true;
+      }
+   }
+
+   return false;
+}
+
+/// Longest prefix of a Style: three sequences of up to six bytes.
+inline constexpr std::size_t const STYLE_PREFIX_MAX{18};
+
+/// The sequences that end a Style, one per code, "\33[0m" each.
+inline constexpr std::string_view const STYLE_RESETS{"\33[0m\33[0m\33[0m"};
+
+/**
+ * @class Style
+ * @brief A foreground color, a background color and a font style, with the
+ * escape sequences that select them composed once, at compile time when the
+ * Style is constexpr.
+ *
+ * Text in a Style is prefix() + text + suffix(), the same bytes as
+ * ext::fstring::color, background and style applied in this order.
+ *
+ * Example:
+ * ```
+ * constexpr ext::Style const prompt{ext::cfg::blue, ext::cbg::none,
+ *                                   ext::stl::italic};
+ * ```
+ */
+class Style {
+ private:
+   char m_prefix[STYLE_PREFIX_MAX]; ///< The sequences that select the codes.
+   std::size_t m_prefix_size;       ///< Bytes used in m_prefix.
+   std::size_t m_codes;             ///< Number of codes selected.
+
+   /**
+    * @brief Appends the sequence that selects a code, "\33[<code>m".
+    * @param code_ The code, from 0 to 999.
+    */
+   constexpr void add(short code_) {
+      m_prefix[m_prefix_size++] = '\33';
+      m_prefix[m_prefix_size++] = '[';
+
+      if (code_ >= 100) {
+         m_prefix[m_prefix_size++] = static_cast<char>('0' + code_ / 100);
+      }
+
+      if (code_ >= 10) {
+         m_prefix[m_prefix_size++] = static_cast<char>('0' + code_ / 10 % 10);
+      }
+
+      m_prefix[m_prefix_size++] = static_cast<char>('0' + code_ % 10);
+      m_prefix[m_prefix_size++] = 'm';
+      ++m_codes;
+   }
+
+ public:
+   /**
+    * @brief Constructor for the Style class. A code that is none or not in its
+    * list is left out.
+    * @param color_ The foreground color (cfg::none for none).
+    * @param background_ The background color (cbg::none for none).
+    * @param style_ The font style (stl::none for none).
+    */
+   constexpr Style(short color_ = cfg::none, short background_ = cbg::none,
+                   short style_ = stl::none)
+       : m_prefix{}, m_prefix_size{0}, m_codes{0} {
+      // The code applied last wraps the others, so it comes first.
+      if (isAnsiCode(stl::list, style_)) {
+         add(style_);
+      }
+
+      if (isAnsiCode(cbg::list, background_)) {
+         add(background_);
+      }
+
+      if (isAnsiCode(cfg::list, color_)) {
+         add(color_);
+      }
+   }
+
+   /**
+    * @brief Get the sequences written before the text.
+    * @return A view of the sequences.
+    */
+   constexpr std::string_view prefix() const {
+      return {m_prefix, m_prefix_size};
+   }
+
+   /**
+    * @brief Get the sequences written after the text.
+    * @return A view of the sequences.
+    */
+   constexpr std::string_view suffix() const {
+      return STYLE_RESETS.substr(0, m_codes * 4);
+   }
+
+   /**
+    * @brief Checks if the style selects no code.
+    * @return True if the text is left as it is; otherwise, false.
+    */
+   constexpr bool empty() const { return m_codes == 0; }
+};
 } // namespace ext
 
 #endif // STYLE_HPP_
@@ -0,0 +1,233 @@
+/**
+ * @file Packing.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief This file defines helpers to pack integers into as few bytes as they
+ * need.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * - Varints store an unsigned integer 7 bits per byte, the high bit of each
+ *   byte telling whether another one follows (as in Protocol Buffers), so
+ *   small values take a single byte.
+ * - Zigzag maps signed integers to unsigned ones (0, -1, 1, -2, ...), so small
+ *   negative values stay small varints.
+ * - BitWriter and BitReader store fixed-width fields back to back, least
+ *   significant bits first, without rounding each one up to a byte.
+ *
+ * Example:
+ * ```
+ * std::vector<unsigned char> bytes;
+ * ext::putVarint(bytes, ext::zigzag(-3));
+ * ext::BitWriter bits{bytes};
+ * bits.put(809, 10);
+ * bits.flush();
+ * ```
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PACKING_HPP_
+#define PACKING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Namespace 'ext' for external utilities and extensions.
+ */
+namespace ext {
+/// Largest number of bytes of a 32-bit varint.
+constexpr size_t const VARINT_MAX_BYTES{5};
+
+/**
+ * @brief Maps a signed integer to an unsigned one, small magnitudes first.
+ * @param value_ The signed integer.
+ * @return The unsigned integer.
+ */
+constexpr std::uint32_t zigzag(std::int32_t value_) {
+   return (static_cast<std::uint32_t>(value_) << 1) ^
+          static_cast<std::uint32_t>(value_ < 0 ? -1 : 0);
+}
+
+/**
+ * @brief Maps back an integer given by zigzag().
+ * @param value_ The unsigned integer.
+ * @return The signed integer.
+ */
+constexpr std::int32_t unzigzag(std::uint32_t value_) {
+   return static_cast<std::int32_t>((value_ >> 1) ^ (0u - (value_ & 1u)));
+}
+
+/**
+ * @brief Appends a varint.
+ * @param bytes_ The bytes to append to.
+ * @param value_ The value.
+ */
+inline void putVarint(std::vector<unsigned char> &bytes_,
+                      std::uint32_t value_) {
+   while (value_ >= 0x80u) {
+      bytes_.push_back(static_cast<unsigned char>(value_ | 0x80u));
+      value_ >>= 7;
+   }
+
+   bytes_.push_back(static_cast<unsigned char>(value_));
+}
+
+/**
+ * @brief Reads a varint.
+ * @param data_ The first byte of the buffer.
+ * @param size_ The size of the buffer.
+ * @param offset_ The offset of the varint, moved past it on success.
+ * @param value_ Receives the value.
+ * @return True if a whole varint was read; false if the buffer ends first or
+ * the varint is too long.
+ */
+inline bool getVarint(unsigned char const *data_, size_t size_,
+                      size_t &offset_, std::uint32_t &value_) {
+   std::uint32_t value{0};
+
+   for (size_t index{0}; index != VARINT_MAX_BYTES; ++index) {
+      if (offset_ + index == size_) {
+         return false;
+      }
+
+      unsigned char byte{data_[offset_ + index]};
+      value |= static_cast<std::uint32_t>(byte & 0x7Fu) << (7 * index);
+
+      if ((byte & 0x80u) == 0) {
+         offset_ += index + 1;
+         value_ = value;
+         return true;
+      }
+   }
+
+   return false;
+}
+
+/**
+ * @brief Appends a 32-bit integer in little-endian order.
+ * @param bytes_ The bytes to append to.
+ * @param value_ The value.
+ */
+inline void putFixed32(std::vector<unsigned char> &bytes_,
+                       std::uint32_t value_) {
+   for (int shift{0}; shift != 32; shift += 8) {
+      bytes_.push_back(static_cast<unsigned char>(value_ >> shift));
+   }
+}
+
+/**
+ * @brief Reads a 32-bit integer in little-endian order.
+ * @param data_ The first of its four bytes.
+ * @return The value.
+ */
+inline std::uint32_t getFixed32(unsigned char const *data_) {
+   return static_cast<std::uint32_t>(data_[0]) |
+          static_cast<std::uint32_t>(data_[1]) << 8 |
+          static_cast<std::uint32_t>(data_[2]) << 16 |
+          static_cast<std::uint32_t>(data_[3]) << 24;
+}
+
+/**
+ * @brief Number of bytes taken by fields of a fixed width.
+ * @param count_ The number of fields.
+ * @param bits_ The width of each field.
+ * @return The bytes, the last one padded with zeros.
+ */
+constexpr size_t packedBytes(size_t count_, unsigned bits_) {
+   return (count_ * bits_ + 7) / 8;
+}
+
+/**
+ * @class BitWriter
+ * @brief Appends fields of up to 32 bits to bytes, without padding.
+ */
+class BitWriter {
+ private:
+   std::vector<unsigned char> &m_bytes; ///< The bytes appended to.
+   std::uint64_t m_buffer;              ///< Bits not yet appended.
+   unsigned m_bits;                     ///< Number of bits in m_buffer.
+
+ public:
+   /**
+    * @brief Constructor for the BitWriter class.
+    * @param bytes_ The bytes to append to.
+    */
+   explicit BitWriter(std::vector<unsigned char> &bytes_)
+       : m_bytes{bytes_}, m_buffer{0}, m_bits{0} {}
+
+   /**
+    * @brief Appends a field.
+    * @param value_ The value, which must fit in the field.
+    * @param bits_ The width of the field (1 to 32).
+    */
+   void put(std::uint32_t value_, unsigned bits_) {
+      m_buffer |= static_cast<std::uint64_t>(value_) << m_bits;
+      m_bits += bits_;
+
+      while (m_bits >= 8) {
+         m_bytes.push_back(static_cast<unsigned char>(m_buffer));
+         m_buffer >>= 8;
+         m_bits -= 8;
+      }
+   }
+
+   /**
+    * @brief Appends the bits left, padding the last byte with zeros.
+    */
+   void flush() {
+      if (m_bits != 0) {
+         m_bytes.push_back(static_cast<unsigned char>(m_buffer));
+         m_buffer = 0;
+         m_bits = 0;
+      }
+   }
+};
+
+/**
+ * @class BitReader
+ * @brief Reads the fields written by BitWriter.
+ */
+class BitReader {
+ private:
+   unsigned char const *m_data; ///< The next byte to read.
+   unsigned char const *m_end;  ///< The end of the bytes.
+   std::uint64_t m_buffer;      ///< Bits read but not yet taken.
+   unsigned m_bits;             ///< Number of bits in m_buffer.
+
+ public:
+   /**
+    * @brief Constructor for the BitReader class.
+    * @param data_ The first byte.
+    * @param size_ The number of bytes.
+    */
+   BitReader(unsigned char const *data_, size_t size_)
+       : m_data{data_}, m_end{data_ + size_}, m_buffer{0}, m_bits{0} {}
+
+   /**
+    * @brief Reads a field.
+    * @param bits_ The width of the field (1 to 32).
+    * @param value_ Receives the value.
+    * @return True if the field was read; false if the bytes end first.
+    */
+   bool get(unsigned bits_, std::uint32_t &value_) {
+      while (m_bits < bits_) {
+         if (m_data == m_end) {
+            return false;
+         }
+
+         m_buffer |= static_cast<std::uint64_t>(*m_data++) << m_bits;
+         m_bits += 8;
+      }
+
+      value_ = static_cast<std::uint32_t>(m_buffer & ((1ull << bits_) - 1));
+      m_buffer >>= bits_;
+      m_bits -= bits_;
+      return true;
+   }
+};
+} // namespace ext
+
+#endif /// PACKING_HPP_
@@ -0,0 +1,118 @@
+/**
+ * @file SpscQueue.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief A bounded lock-free queue for one producer and one consumer thread.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The queue is a ring of slots with two counters: the producer only writes
+ * the tail and the consumer only writes the head, each on its own cache line.
+ * Neither side ever waits for the other: pushing to a full queue or popping
+ * from an empty one fails at once.
+ *
+ * Example:
+ * ```
+ * ext::SpscQueue<int> queue{64};
+ * // Producer thread:
+ * queue.push(42);
+ * // Consumer thread:
+ * int value;
+ * while (queue.pop(value)) {
+ *    use(value);
+ * }
+ * ```
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SPSC_QUEUE_HPP_
+#define SPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Namespace 'ext' for external utilities and extensions.
+ */
+namespace ext {
+/**
+ * @class SpscQueue
+ * @brief A bounded single-producer, single-consumer lock-free queue.
+ * @tparam Type The type of the values; must be default constructible and
+ * movable.
+ */
+template <class Type> class SpscQueue {
+ private:
+   std::unique_ptr<Type[]> m_slots; ///< The ring of values.
+   size_t m_mask;                   ///< Capacity minus one (a power of two).
+
+   alignas(64) std::atomic<size_t> m_head{0}; ///< Next slot to pop.
+   alignas(64) std::atomic<size_t> m_tail{0}; ///< Next slot to push.
+
+ public:
+   /**
+    * @brief Constructor for the SpscQueue class.
+    * @param capacity_ Minimum number of values held (rounded up to a power of
+    * two).
+    */
+   explicit SpscQueue(size_t capacity_) {
+      size_t capacity{1};
+      while (capacity < capacity_) {
+         capacity <<= 1;
+      }
+
+      m_slots = std::make_unique<Type[]>(capacity);
+      m_mask = capacity - 1;
+   }
+
+   /**
+    * @brief Deleted copy constructor.
+    */
+   SpscQueue(SpscQueue const &other_) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator.
+    */
+   SpscQueue &operator=(SpscQueue const &other_) = delete;
+
+   /**
+    * @brief Adds a value at the end; only called by the producer.
+    * @param value_ The value, moved into the queue only if there is room.
+    * @return True if the value was added; false if the queue is full.
+    */
+   bool push(Type &&value_) {
+      size_t tail{m_tail.load(std::memory_order_relaxed)};
+
+      if (tail - m_head.load(std::memory_order_acquire) > m_mask) {
+         return false;
+      }
+
+      m_slots[tail & m_mask] = std::move(value_);
+      m_tail.store(tail + 1, std::memory_order_release);
+      return true;
+   }
+
+   /**
+    * @brief Removes the value at the front; only called by the consumer.
+    * @param value_ Receives the value.
+    * @return True if a value was removed; false if the queue is empty.
+    */
+   bool pop(Type &value_) {
+      size_t head{m_head.load(std::memory_order_relaxed)};
+
+      if (head == m_tail.load(std::memory_order_acquire)) {
+         return false;
+      }
+
+      value_ = std::move(m_slots[head & m_mask]);
+      m_slots[head & m_mask] = Type{};
+      m_head.store(head + 1, std::memory_order_release);
+      return true;
+   }
+};
+} // namespace ext
+
+#endif /// SPSC_QUEUE_HPP_
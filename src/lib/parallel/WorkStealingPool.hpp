@@ -0,0 +1,280 @@
+/**
+ * @file WorkStealingPool.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief A thread pool that runs index ranges with work stealing.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The pool splits the indices [0, count) in one contiguous range per worker.
+ * Each worker takes small slices from the front of its own range; a worker
+ * that runs out of work steals the back half of the largest range left. This
+ * keeps every core busy when the cost of the items is uneven, while workers
+ * mostly touch their own cache line.
+ *
+ * Example:
+ * ```
+ * ext::WorkStealingPool pool;
+ * pool.run(items.size(), [&](size_t index_, unsigned worker_) {
+ *    process(items[index_], worker_);
+ * });
+ * ```
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef WORK_STEALING_POOL_HPP_
+#define WORK_STEALING_POOL_HPP_
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Namespace 'ext' for external utilities and extensions.
+ */
+namespace ext {
+/**
+ * @class WorkStealingPool
+ * @brief A fixed set of worker threads that share index ranges by stealing.
+ */
+class WorkStealingPool {
+ private:
+   /**
+    * @struct Range
+    * @brief The indices still to be processed by one worker.
+    *
+    * Aligned to a cache line so workers do not share lines.
+    */
+   struct alignas(64) Range {
+      std::mutex m_mutex; ///< Guards the bounds.
+      size_t m_begin{0};  ///< First index left.
+      size_t m_end{0};    ///< One past the last index left.
+   };
+
+   std::vector<std::thread> m_threads; ///< The worker threads.
+   std::unique_ptr<Range[]> m_ranges;  ///< The range of each worker.
+   unsigned m_size;                    ///< Number of workers.
+
+   std::mutex m_mutex;              ///< Guards the job state below.
+   std::condition_variable m_start; ///< Signals a new job or the shutdown.
+   std::condition_variable m_done;  ///< Signals the end of a job.
+   std::function<void(size_t, size_t, unsigned)>
+       m_job;              ///< Current job, called on [begin, end) slices.
+   size_t m_grain{1};      ///< Indices taken per slice.
+   size_t m_generation{0}; ///< Counter of submitted jobs.
+   unsigned m_running{0};  ///< Workers still busy with the current job.
+   bool m_stop{false};     ///< Whether the pool is shutting down.
+
+   /**
+    * @brief Takes a slice from the front of a worker's own range.
+    * @param worker_ The worker index.
+    * @param begin_ Receives the first index of the slice.
+    * @param end_ Receives one past the last index of the slice.
+    * @return True if a slice was taken; otherwise, false.
+    */
+   bool pop(unsigned worker_, size_t &begin_, size_t &end_) {
+      Range &range{m_ranges[worker_]};
+      std::lock_guard<std::mutex> lock{range.m_mutex};
+
+      if (range.m_begin == range.m_end) {
+         return false;
+      }
+
+      begin_ = range.m_begin;
+      end_ = std::min(range.m_end, range.m_begin + m_grain);
+      range.m_begin = end_;
+      return true;
+   }
+
+   /**
+    * @brief Steals the back half of the largest range of another worker and
+    * makes it the range of this worker.
+    * @param worker_ The worker index.
+    * @return True if something was stolen; otherwise, false.
+    */
+   bool steal(unsigned worker_) {
+      while (true) {
+         // Pick the victim with the most work left.
+         unsigned victim{worker_};
+         size_t largest{0};
+
+         for (unsigned other{0}; other != m_size; ++other) {
+            if (other == worker_) {
+               continue;
+            }
+
+            std::lock_guard<std::mutex> lock{m_ranges[other].m_mutex};
+            size_t left{m_ranges[other].m_end - m_ranges[other].m_begin};
+
+            if (left > largest) {
+               largest = left;
+               victim = other;
+            }
+         }
+
+         if (victim == worker_) {
+            return false; // Every range is empty.
+         }
+
+         size_t begin{0};
+         size_t end{0};
+         {
+            Range &range{m_ranges[victim]};
+            std::lock_guard<std::mutex> lock{range.m_mutex};
+            size_t left{range.m_end - range.m_begin};
+
+            // The victim may have drained its range meanwhile; look again.
+            if (left == 0) {
+               continue;
+            }
+
+            end = range.m_end;
+            begin = end - (left + 1) / 2;
+            range.m_end = begin;
+         }
+
+         Range &own{m_ranges[worker_]};
+         std::lock_guard<std::mutex> lock{own.m_mutex};
+         own.m_begin = begin;
+         own.m_end = end;
+         return true;
+      }
+   }
+
+   /**
+    * @brief The loop run by every worker thread.
+    * @param worker_ The worker index.
+    */
+   void work(unsigned worker_) {
+      size_t generation{0};
+
+      while (true) {
+         {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_start.wait(lock, [&]() {
+               return m_stop || m_generation != generation;
+            });
+
+            if (m_stop) {
+               return;
+            }
+
+            generation = m_generation;
+         }
+
+         size_t begin{0};
+         size_t end{0};
+
+         while (pop(worker_, begin, end) ||
+                (steal(worker_) && pop(worker_, begin, end))) {
+            m_job(begin, end, worker_);
+         }
+
+         std::lock_guard<std::mutex> lock{m_mutex};
+         if (--m_running == 0) {
+            m_done.notify_all();
+         }
+      }
+   }
+
+ public:
+   /**
+    * @brief Constructor for the WorkStealingPool class.
+    * @param threads_ Number of workers (0 uses one per hardware thread).
+    */
+   explicit WorkStealingPool(unsigned threads_ = 0) {
+      if (threads_ == 0) {
+         threads_ = std::max(1u, std::thread::hardware_concurrency());
+      }
+
+      m_size = threads_;
+      m_ranges = std::make_unique<Range[]>(m_size);
+      m_threads.reserve(m_size);
+
+      for (unsigned worker{0}; worker != m_size; ++worker) {
+         m_threads.emplace_back(&WorkStealingPool::work, this, worker);
+      }
+   }
+
+   /**
+    * @brief Deleted copy constructor; workers point back to their pool.
+    */
+   WorkStealingPool(WorkStealingPool const &other_) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator.
+    */
+   WorkStealingPool &operator=(WorkStealingPool const &other_) = delete;
+
+   /**
+    * @brief Destructor for the WorkStealingPool class; joins the workers.
+    */
+   ~WorkStealingPool() {
+      {
+         std::lock_guard<std::mutex> lock{m_mutex};
+         m_stop = true;
+      }
+
+      m_start.notify_all();
+
+      for (std::thread &thread : m_threads) {
+         thread.join();
+      }
+   }
+
+   /**
+    * @brief Get the number of workers.
+    * @return The number of worker threads.
+    */
+   unsigned size() const { return m_size; }
+
+   /**
+    * @brief Runs a function on every index of [0, count) and waits for it.
+    *
+    * @tparam Function Callable as `function_(size_t index, unsigned worker)`.
+    * @param count_ Number of indices.
+    * @param function_ The function to run; calls from different workers run
+    * concurrently.
+    * @param grain_ Indices taken per slice (0 picks a size that gives each
+    * worker a few dozen slices).
+    */
+   template <class Function>
+   void run(size_t count_, Function const &function_, size_t grain_ = 0) {
+      if (count_ == 0) {
+         return;
+      }
+
+      std::unique_lock<std::mutex> lock{m_mutex};
+
+      m_job = [&function_](size_t begin_, size_t end_, unsigned worker_) {
+         for (size_t index{begin_}; index != end_; ++index) {
+            function_(index, worker_);
+         }
+      };
+
+      m_grain = grain_ != 0 ? grain_
+                            : std::max<size_t>(1, count_ / (m_size * 32));
+
+      // Give each worker a contiguous share of the indices.
+      for (unsigned worker{0}; worker != m_size; ++worker) {
+         std::lock_guard<std::mutex> range_lock{m_ranges[worker].m_mutex};
+         m_ranges[worker].m_begin = count_ * worker / m_size;
+         m_ranges[worker].m_end = count_ * (worker + 1) / m_size;
+      }
+
+      m_running = m_size;
+      ++m_generation;
+      m_start.notify_all();
+
+      m_done.wait(lock, [&]() { return m_running == 0; });
+      m_job = nullptr;
+   }
+};
+} // namespace ext
+
+#endif /// WORK_STEALING_POOL_HPP_
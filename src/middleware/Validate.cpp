@@ -9,97 +9,375 @@
  */
 
 #include "Validate.hpp"
+#include "parallel/WorkStealingPool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
 
-/// @brief Check if the rows of a Sudoku board are valid.
-/// @param board_ The Sudoku board to be checked.
-/// @return True if all rows are valid; otherwise, false.
-bool checkLines(Board const &board_) {
-   // Iterate through each row of the Sudoku board.
-   for (int row{0}; row != BOARD_SIZE; ++row) {
-      int values[BOARD_SIZE]{
-          0}; // Array to keep track of each value's occurrence.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VALIDATE_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/// Layouts of the digit bits of a board, one per kind of unit.
+enum UnitLayout {
+   LayoutRows,    ///< Slice k holds column k; lane u is row u.
+   LayoutColumns, ///< Slice k holds row k; lane u is column u.
+   LayoutBlocks,  ///< Slice k holds the k-th cell of every block.
+   LayoutsCount,  ///< Number of layouts.
+};
+
+/// Every layout, as a bit set of UnitLayout values.
+constexpr unsigned const ALL_LAYOUTS{(1u << LayoutRows) |
+                                     (1u << LayoutColumns) |
+                                     (1u << LayoutBlocks)};
 
-      // Iterate through each column in the current row.
+/// Fault reported when a unit of each layout is invalid.
+constexpr unsigned const LAYOUT_FAULTS[LayoutsCount]{FaultRow, FaultColumn,
+                                                     FaultBlock};
+
+/// Banks smaller than this are validated without starting threads.
+constexpr size_t const PARALLEL_MIN_BOARDS{4096};
+
+/// Lanes read past the last slice by a 16-lane load.
+constexpr int const LAYOUT_PADDING{7};
+
+/// @brief Digit bits of a board laid out as 9 slices of 9 lanes, one lane
+/// per unit. OR-ing the slices gives the digits present in each unit, which
+/// must be FULL_MASK: nine one-bit values can only cover nine bits when they
+/// are all different, and cells out of range contribute no bit.
+struct UnitBits {
+   alignas(32) unsigned short m_slices[LayoutsCount]
+                                      [CELLS_COUNT + LAYOUT_PADDING];
+};
+
+/// @brief Builds the position of each cell in each layout.
+/// @return The table of positions, indexed by layout and cell.
+static constexpr std::array<std::array<unsigned char, CELLS_COUNT>,
+                            LayoutsCount>
+makePositions() {
+   std::array<std::array<unsigned char, CELLS_COUNT>, LayoutsCount>
+       positions{};
+
+   for (int row{0}; row != BOARD_SIZE; ++row) {
       for (int column{0}; column != BOARD_SIZE; ++column) {
-         int absolute{std::abs(board_.m_values[row][column])};
-
-         // Check if the value is out of the valid range (1-9).
-         if (absolute < 1 || absolute > BOARD_SIZE) {
-            return false; // If an invalid value is found, return false.
-         } else {
-            ++values[absolute -
-                     1]; // Increment the count for the current value.
+         int cell{row * BOARD_SIZE + column};
+         int slice{(row % BLOCK_SIZE) * BLOCK_SIZE + column % BLOCK_SIZE};
+
+         positions[LayoutRows][cell] = column * BOARD_SIZE + row;
+         positions[LayoutColumns][cell] = cell;
+         positions[LayoutBlocks][cell] =
+             slice * BOARD_SIZE + blockIndex(row, column);
+      }
+   }
+
+   return positions;
+}
+
+/// Position of each cell in each layout.
+static constexpr std::array<std::array<unsigned char, CELLS_COUNT>,
+                            LayoutsCount> const POSITIONS{makePositions()};
+
+/// @brief Get the digit bit of a cell value, ignoring its sign.
+/// @param value_ The cell value.
+/// @return The digit bit, or 0 if the value is not between 1 and 9.
+static inline unsigned short digitBit(int value_) {
+   unsigned magnitude{value_ < 0 ? 0u - static_cast<unsigned>(value_)
+                                 : static_cast<unsigned>(value_)};
+   return magnitude - 1u < static_cast<unsigned>(BOARD_SIZE)
+              ? digitMask(static_cast<int>(magnitude))
+              : 0;
+}
+
+/// @brief Fills the requested layouts with the digit bits of a board.
+/// @param board_ The Sudoku board.
+/// @param bits_ Receives the layouts.
+/// @tparam LAYOUTS Bit set of the UnitLayout values to fill.
+template <unsigned LAYOUTS>
+static void fillBits(Board const &board_, UnitBits &bits_) {
+   int const *values{&board_.m_values[0][0]};
+
+   for (int layout{0}; layout != LayoutsCount; ++layout) {
+      if ((LAYOUTS >> layout) & 1u) {
+         for (int lane{0}; lane != LAYOUT_PADDING; ++lane) {
+            bits_.m_slices[layout][CELLS_COUNT + lane] = 0;
          }
       }
+   }
+
+   for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+      unsigned short bit{digitBit(values[cell])};
 
-      // Ensure each value (1-9) appears exactly once in the row.
-      for (int value{0}; value != BOARD_SIZE; ++value) {
-         if (values[value] != 1) {
-            return false; // If a value occurs more or less than once, return
-                          // false.
+      for (int layout{0}; layout != LayoutsCount; ++layout) {
+         if ((LAYOUTS >> layout) & 1u) {
+            bits_.m_slices[layout][POSITIONS[layout][cell]] = bit;
          }
       }
    }
+}
+
+#if !defined(__SSE2__)
+/// @brief Checks a layout with plain integer operations.
+/// @param slices_ The 9 slices of the layout.
+/// @return True if every unit holds all nine digits; otherwise, false.
+static bool reduceScalar(unsigned short const *slices_) {
+   for (int lane{0}; lane != BOARD_SIZE; ++lane) {
+      unsigned short digits{0};
+
+      for (int slice{0}; slice != BOARD_SIZE; ++slice) {
+         digits |= slices_[slice * BOARD_SIZE + lane];
+      }
+
+      if (digits != FULL_MASK) {
+         return false;
+      }
+   }
+
+   return true;
+}
+#endif
+
+#if defined(__SSE2__)
+/// @brief Checks a layout with SSE2: lanes 0-7 in a register, lane 8 apart.
+/// @param slices_ The 9 slices of the layout.
+/// @return True if every unit holds all nine digits; otherwise, false.
+static bool reduceSse2(unsigned short const *slices_) {
+   __m128i digits{_mm_setzero_si128()};
+   unsigned short last{0};
+
+   for (int slice{0}; slice != BOARD_SIZE; ++slice) {
+      digits = _mm_or_si128(digits,
+                            _mm_loadu_si128(reinterpret_cast<__m128i const *>(
+                                slices_ + slice * BOARD_SIZE)));
+      last |= slices_[slice * BOARD_SIZE + BOARD_SIZE - 1];
+   }
+
+   __m128i full{_mm_cmpeq_epi16(digits, _mm_set1_epi16(FULL_MASK))};
+   return _mm_movemask_epi8(full) == 0xFFFF && last == FULL_MASK;
+}
+#endif
+
+#if defined(VALIDATE_AVX2)
+/// @brief Checks a layout with AVX2: all nine lanes in one register.
+/// @param slices_ The 9 slices of the layout, padded after the last one.
+/// @return True if every unit holds all nine digits; otherwise, false.
+__attribute__((target("avx2"))) static bool
+reduceAvx2(unsigned short const *slices_) {
+   __m256i digits{_mm256_setzero_si256()};
+
+   for (int slice{0}; slice != BOARD_SIZE; ++slice) {
+      digits = _mm256_or_si256(
+          digits, _mm256_loadu_si256(reinterpret_cast<__m256i const *>(
+                      slices_ + slice * BOARD_SIZE)));
+   }
+
+   __m256i full{_mm256_cmpeq_epi16(digits, _mm256_set1_epi16(FULL_MASK))};
+
+   // Only the first nine lanes (two mask bits each) are units.
+   unsigned mask{static_cast<unsigned>(_mm256_movemask_epi8(full))};
+   return (mask & 0x3FFFF) == 0x3FFFF;
+}
+#endif
+
+/// @brief Checks a layout with the widest instructions of the processor.
+/// @param slices_ The 9 slices of the layout.
+/// @return True if every unit holds all nine digits; otherwise, false.
+static bool reduceLayout(unsigned short const *slices_) {
+#if defined(VALIDATE_AVX2)
+   static bool const has_avx2{__builtin_cpu_supports("avx2") != 0};
+
+   if (has_avx2) {
+      return reduceAvx2(slices_);
+   }
+#endif
+
+#if defined(__SSE2__)
+   return reduceSse2(slices_);
+#else
+   return reduceScalar(slices_);
+#endif
+}
+
+/// @brief Checks the requested kinds of units of a board.
+/// @param board_ The Sudoku board.
+/// @tparam LAYOUTS Bit set of the UnitLayout values to check.
+/// @return True if every unit checked holds all nine digits.
+template <unsigned LAYOUTS> static bool checkUnits(Board const &board_) {
+   UnitBits bits;
+   fillBits<LAYOUTS>(board_, bits);
+
+   for (int layout{0}; layout != LayoutsCount; ++layout) {
+      if (((LAYOUTS >> layout) & 1u) &&
+          !reduceLayout(bits.m_slices[layout])) {
+         return false;
+      }
+   }
 
-   return true; // If all rows are valid, return true.
+   return true;
+}
+
+/// @brief Check if the rows of a Sudoku board are valid.
+/// @param board_ The Sudoku board to be checked.
+/// @return True if all rows are valid; otherwise, false.
+bool checkLines(Board const &board_) {
+   return checkUnits<1u << LayoutRows>(board_);
 }
 
 /// @brief Check if the columns of a Sudoku board are valid.
 /// @param board_ The Sudoku board to be checked.
 /// @return True if all columns are valid; otherwise, false.
 bool checkColumns(Board const &board_) {
-   // Iterate through each column of the Sudoku board.
-   for (int column{0}; column != BOARD_SIZE; ++column) {
-      int values[BOARD_SIZE]{
-          0}; // Array to keep track of each value's occurrence.
-
-      // Iterate through each row in the current column.
-      for (int row{0}; row != BOARD_SIZE; ++row) {
-         int absolute{std::abs(board_.m_values[row][column])};
-
-         // Check if the value is out of the valid range (1-9).
-         if (absolute < 1 || absolute > BOARD_SIZE) {
-            return false; // If an invalid value is found, return false.
-         } else {
-            ++values[absolute -
-                     1]; // Increment the count for the current value.
-         }
-      }
+   return checkUnits<1u << LayoutColumns>(board_);
+}
 
-      // Ensure each value (1-9) appears exactly once in the column.
-      for (int value{0}; value != BOARD_SIZE; ++value) {
-         if (values[value] != 1) {
-            return false; // If a value occurs more or less than once, return
-                          // false.
-         }
+/// @brief Check if the blocks of a Sudoku board are valid.
+/// @param board_ The Sudoku board to be checked.
+/// @return True if all blocks are valid; otherwise, false.
+bool checkBlocks(Board const &board_) {
+   return checkUnits<1u << LayoutBlocks>(board_);
+}
+
+/// @brief Check if a Sudoku board is valid by verifying its rows, columns and
+/// blocks.
+/// @param board_ The Sudoku board to be checked.
+/// @return True if the board is valid; otherwise, false.
+bool checkBoard(Board const &board_) {
+   // Fill the three layouts in a single pass over the board.
+   return checkUnits<ALL_LAYOUTS>(board_);
+}
+
+/// @brief Find every reason for a Sudoku board to be invalid.
+/// @param board_ The Sudoku board to be checked.
+/// @return A bit set of BoardFault values; FaultNone if the board is valid.
+unsigned boardFaults(Board const &board_) {
+   UnitBits bits;
+   fillBits<ALL_LAYOUTS>(board_, bits);
+
+   unsigned faults{FaultNone};
+
+   // Cells out of range are the ones left without a digit bit.
+   unsigned short const *cells{bits.m_slices[LayoutColumns]};
+   if (std::find(cells, cells + CELLS_COUNT, 0) != cells + CELLS_COUNT) {
+      faults |= FaultRange;
+   }
+
+   for (int layout{0}; layout != LayoutsCount; ++layout) {
+      if (!reduceLayout(bits.m_slices[layout])) {
+         faults |= LAYOUT_FAULTS[layout];
       }
    }
 
-   return true; // If all columns are valid, return true.
+   return faults;
 }
 
-/// @brief Check if a Sudoku board is valid by verifying both rows and columns.
-/// @param board_ The Sudoku board to be checked.
+/// @brief Check a board of a bank.
+/// @param bank_ The bank holding the board.
+/// @param boards_ The boards of a raw bank, or nullptr if the bank is packed.
+/// @param index_ The position of the board.
 /// @return True if the board is valid; otherwise, false.
-bool checkBoard(Board const &board_) {
-   // Call the checkLines and checkColumns functions to validate the entire
-   // board.
-   return checkLines(board_) && checkColumns(board_);
+static bool validBoard(BankView const &bank_, Board const *boards_,
+                       size_t index_) {
+   // Raw boards are checked where they are mapped.
+   return boards_ != nullptr ? checkBoard(boards_[index_])
+                             : checkBoard(bank_[index_]);
 }
 
-/// @brief Validate a Sudoku bank by checking each board in it.
+/// @brief Check if every board of a Sudoku bank is valid.
 /// @param bank_ The Sudoku bank to be validated.
+/// @param threads_ Number of threads (0 uses one per hardware thread).
 /// @return True if all boards in the bank are valid; otherwise, false.
-bool validateBank(Bank const &bank_) {
-   // Iterate through each board in the bank and check its validity using
-   // checkBoard.
-   for (Board board : bank_.m_boards) {
-      if (!checkBoard(board)) {
-         return false; // Return false if any board is invalid.
+bool validateBank(BankView const &bank_, unsigned threads_) {
+   Board const *boards{bank_.data()};
+
+   // Small banks are checked faster than threads can be started.
+   if (threads_ == 1 || bank_.size() < PARALLEL_MIN_BOARDS) {
+      for (size_t index{0}; index != bank_.size(); ++index) {
+         if (!validBoard(bank_, boards, index)) {
+            return false; // Return false if any board is invalid.
+         }
+      }
+
+      return true; // If all boards are valid, return true.
+   }
+
+   ext::WorkStealingPool pool{threads_};
+   std::atomic<bool> valid{true};
+
+   pool.run(bank_.size(), [&](size_t index_, unsigned) {
+      // Once a board is invalid the answer is known: skip the others.
+      if (valid.load(std::memory_order_relaxed) &&
+          !validBoard(bank_, boards, index_)) {
+         valid.store(false, std::memory_order_relaxed);
+      }
+   });
+
+   return valid.load();
+}
+
+/// @brief Check a board of a bank and record it if it is invalid.
+/// @param bank_ The bank holding the board.
+/// @param boards_ The boards of a raw bank, or nullptr if the bank is packed.
+/// @param index_ The position of the board.
+/// @param errors_ Receives the board if it is invalid.
+static void reportBoard(BankView const &bank_, Board const *boards_,
+                        size_t index_, std::vector<BoardError> &errors_) {
+   unsigned faults{FaultNone};
+   int id{0};
+
+   if (boards_ != nullptr) {
+      // Raw boards are checked where they are mapped.
+      faults = boardFaults(boards_[index_]);
+      id = boards_[index_].m_id;
+   } else {
+      Board board{bank_[index_]};
+      faults = boardFaults(board);
+      id = board.m_id;
+   }
+
+   if (faults != FaultNone) {
+      errors_.push_back({index_, id, faults});
+   }
+}
+
+/// @brief Check every board of a Sudoku bank and report the invalid ones.
+/// @param bank_ The Sudoku bank to be checked.
+/// @param threads_ Number of threads (0 uses one per hardware thread).
+/// @return The invalid boards, in bank order.
+std::vector<BoardError> reportBank(BankView const &bank_, unsigned threads_) {
+   std::vector<BoardError> errors;
+   Board const *boards{bank_.data()};
+
+   // Small banks are checked faster than threads can be started.
+   if (threads_ == 1 || bank_.size() < PARALLEL_MIN_BOARDS) {
+      for (size_t index{0}; index != bank_.size(); ++index) {
+         reportBoard(bank_, boards, index, errors);
       }
+
+      return errors;
    }
 
-   return true; // If all boards are valid, return true.
+   ext::WorkStealingPool pool{threads_};
+
+   // Each worker keeps its own list; they are merged at the end.
+   std::vector<std::vector<BoardError>> found(pool.size());
+
+   pool.run(bank_.size(), [&](size_t index_, unsigned worker_) {
+      reportBoard(bank_, boards, index_, found[worker_]);
+   });
+
+   for (std::vector<BoardError> const &list : found) {
+      errors.insert(errors.end(), list.begin(), list.end());
+   }
+
+   // Stolen ranges leave the lists out of order.
+   std::sort(errors.begin(), errors.end(),
+             [](BoardError const &left_, BoardError const &right_) {
+                return left_.m_position < right_.m_position;
+             });
+
+   return errors;
 }
 
 /// @brief Validate a Sudoku save by checking each action in it.
@@ -16,8 +16,35 @@
 #ifndef VALIDATE_HPP_
 #define VALIDATE_HPP_
 
+#include "BankView.hpp"
 #include "Save.hpp"
 #include "Sudoku.hpp"
+#include <vector>
+
+/**
+ * @enum BoardFault
+ * @brief Reasons for a board to be invalid, combined as a bit set.
+ *
+ * A cell out of range also leaves its row, column and block without a digit,
+ * so it is reported with their faults as well.
+ */
+enum BoardFault {
+   FaultNone = 0,        ///< The board is valid.
+   FaultRange = 1 << 0,  ///< A cell is not between 1 and 9 (ignoring sign).
+   FaultRow = 1 << 1,    ///< A row does not hold all nine digits.
+   FaultColumn = 1 << 2, ///< A column does not hold all nine digits.
+   FaultBlock = 1 << 3,  ///< A block does not hold all nine digits.
+};
+
+/**
+ * @struct BoardError
+ * @brief An invalid board found in a bank.
+ */
+struct BoardError {
+   size_t m_position; ///< Position of the board in the bank.
+   int m_id;          ///< Identifier of the board.
+   unsigned m_faults; ///< Bit set of BoardFault values.
+};
 
 /**
  * @brief Check if the rows in the Sudoku board are valid.
@@ -41,11 +68,24 @@ bool checkLines(Board const &board_);
  */
 bool checkColumns(Board const &board_);
 
+/**
+ * @brief Check if the blocks in the Sudoku board are valid.
+ *
+ * This function checks if the 3x3 blocks in the Sudoku board are valid,
+ * meaning they contain all numbers from 1 to 9 without any repetition.
+ *
+ * @param board_ The Sudoku board to be checked.
+ * @return True if all blocks are valid, false otherwise.
+ */
+bool checkBlocks(Board const &board_);
+
 /**
  * @brief Check if the Sudoku board is valid.
  *
- * This function checks if the Sudoku board is valid by ensuring that both rows
- * and columns contain all numbers from 1 to 9 without any repetition.
+ * This function checks if the Sudoku board is valid by ensuring that its rows,
+ * columns and blocks contain all numbers from 1 to 9 without any repetition.
+ * The units are checked with SIMD instructions when the processor has them
+ * (AVX2, chosen at run time, or SSE2), and with plain integers otherwise.
  *
  * @param board_ The Sudoku board to be checked.
  * @return True if the Sudoku board is valid, false otherwise.
@@ -53,15 +93,38 @@ bool checkColumns(Board const &board_);
 bool checkBoard(Board const &board_);
 
 /**
- * @brief Validate the structure of a Bank.
+ * @brief Find every reason for a Sudoku board to be invalid.
+ *
+ * @param board_ The Sudoku board to be checked.
+ * @return A bit set of BoardFault values; FaultNone if the board is valid.
+ */
+unsigned boardFaults(Board const &board_);
+
+/**
+ * @brief Check if every board of a bank is valid.
+ *
+ * Large banks are split over a thread pool; once a worker finds an invalid
+ * board the others skip the boards left, since the answer is already known.
+ *
+ * @param bank_ The bank to be validated.
+ * @param threads_ Number of threads (0 uses one per hardware thread).
+ * @return True if all boards are valid, false otherwise.
+ */
+bool validateBank(BankView const &bank_, unsigned threads_ = 0);
+
+/**
+ * @brief Check every board of a bank and report the invalid ones.
  *
- * This function checks if the structure of a Bank object is valid, ensuring it
- * contains the required elements and each Sudoku board within it is also valid.
+ * Unlike validateBank, this goes through the whole bank, spread over a thread
+ * pool, to tell which boards are invalid and why. The boards are checked in place in the mapped
+ * file; packed boards are unpacked one at a time.
  *
- * @param bank_ The Bank object to be validated.
- * @return True if the Bank structure is valid, false otherwise.
+ * @param bank_ The bank to be checked.
+ * @param threads_ Number of threads (0 uses one per hardware thread).
+ * @return The invalid boards, in bank order; empty if the bank is valid.
  */
-bool validateBank(Bank const &bank_);
+std::vector<BoardError> reportBank(BankView const &bank_,
+                                   unsigned threads_ = 0);
 
 /**
  * @brief Validate the structure of a Save.
@@ -9,8 +9,9 @@
  * The enum "Action" represents two possible actions: Insert (placing a value on
  * the Sudoku board) and Remove (removing a value from the Sudoku board). The
  * struct "ActionGame" describes an action in a Sudoku game, including its
- * coordinates (m_x and m_y), the value to be inserted or removed (m_value), and
- * the type of action (m_action).
+ * coordinates (m_x and m_y), the value to be inserted or removed (m_value), the
+ * value the cell held before the action (m_previous), and the type of action
+ * (m_action).
  * 
  * @copyright Copyright (c) 2023
  * 
@@ -32,7 +33,12 @@ struct ActionGame {
    short m_y; /**< The y-coordinate (column) where the action is performed on
                  the Sudoku board. */
    short m_value{0}; /**< The value to be inserted or removed (default is 0). */
-   Action m_action;  /**< The type of action, either Insert or Remove. */
+   short m_previous{0}; /**< The value of the cell before the action, so it
+                           can be undone without replaying the game. */
+   Action m_action;     /**< The type of action, either Insert or Remove. */
 };
 
+static_assert(sizeof(ActionGame) == 12,
+              "m_previous must fit in the padding to keep the save layout");
+
 #endif /// ACTIONS_HPP_
@@ -0,0 +1,103 @@
+/**
+ * @file AutosaveWriter.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the background autosave writer.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "AutosaveWriter.hpp"
+#include "SaveJournal.hpp"
+#include <utility>
+
+/// @brief Default constructor for the AutosaveWriter class.
+AutosaveWriter::AutosaveWriter()
+    : m_queue{AUTOSAVE_QUEUE_SIZE}, m_stop{false} {}
+
+/// @brief Destructor for the AutosaveWriter class.
+AutosaveWriter::~AutosaveWriter() { stop(); }
+
+/// @brief Starts the writer thread.
+/// @param file_ The file name of the autosave.
+void AutosaveWriter::start(std::string const &file_) {
+   stop();
+
+   m_file = file_;
+   m_thread = std::thread{&AutosaveWriter::work, this};
+}
+
+/// @brief Writes the last snapshot and stops the writer thread.
+void AutosaveWriter::stop() {
+   if (!m_thread.joinable()) {
+      return;
+   }
+
+   // The last snapshot must reach the writer: wait for room in the queue.
+   if (m_pending != nullptr) {
+      while (!m_queue.push(std::move(m_pending))) {
+         std::this_thread::yield();
+      }
+
+      m_pending.reset();
+   }
+
+   {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_stop = true;
+   }
+
+   m_wake.notify_one();
+   m_thread.join();
+   m_stop = false;
+}
+
+/// @brief Check if the writer thread is running.
+/// @return True if the writer was started; otherwise, false.
+bool AutosaveWriter::isRunning() const { return m_thread.joinable(); }
+
+/// @brief Get the file name of the autosave.
+/// @return The file name given to start().
+std::string const &AutosaveWriter::file() const { return m_file; }
+
+/// @brief Hands a snapshot of the game to the writer, without waiting.
+/// @param save_ The snapshot.
+void AutosaveWriter::submit(Save save_) {
+   std::shared_ptr<Save const> snapshot{
+       std::make_shared<Save const>(std::move(save_))};
+
+   // A snapshot held back before is older than this one: drop it.
+   if (m_queue.push(std::move(snapshot))) {
+      m_pending.reset();
+   } else {
+      m_pending = std::move(snapshot);
+   }
+}
+
+/// @brief The loop run by the writer thread.
+void AutosaveWriter::work() {
+   SaveJournal journal;
+   bool stopping{false};
+
+   while (!stopping) {
+      {
+         std::unique_lock<std::mutex> lock{m_mutex};
+         m_wake.wait_for(lock, AUTOSAVE_INTERVAL, [this]() { return m_stop; });
+         stopping = m_stop;
+      }
+
+      // Only the newest snapshot of a burst is written.
+      std::shared_ptr<Save const> latest;
+      std::shared_ptr<Save const> snapshot;
+
+      while (m_queue.pop(snapshot)) {
+         latest = std::move(snapshot);
+      }
+
+      if (latest != nullptr &&
+          (!journal.isOpen() || !journal.append(*latest))) {
+         journal.create(m_file, *latest);
+      }
+   }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file AutosaveWriter.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares a background thread that saves snapshots of a game.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The game hands each snapshot to the writer through a lock-free queue and
+ * carries on at once. The writer wakes up every AUTOSAVE_INTERVAL, keeps only
+ * the newest snapshot waiting and appends it to its journal (see
+ * SaveJournal.hpp), which flushes it to the disk once for the whole burst.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef AUTOSAVE_WRITER_HPP_
+#define AUTOSAVE_WRITER_HPP_
+
+#include "Save.hpp"
+#include "parallel/SpscQueue.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/// Time between two writes of the autosave.
+constexpr std::chrono::milliseconds const AUTOSAVE_INTERVAL{250};
+
+/// Snapshots that can wait for the writer.
+constexpr size_t const AUTOSAVE_QUEUE_SIZE{64};
+
+/**
+ * @class AutosaveWriter
+ * @brief Saves the snapshots of a game on a background thread.
+ */
+class AutosaveWriter {
+ private:
+   /// Snapshots from the game, shared so handing one over copies nothing.
+   ext::SpscQueue<std::shared_ptr<Save const>> m_queue;
+   std::shared_ptr<Save const>
+       m_pending;        ///< Snapshot the queue had no room for (game side).
+   std::string m_file;   ///< The file name of the autosave.
+   std::thread m_thread; ///< The writer thread.
+
+   std::mutex m_mutex;             ///< Guards m_stop.
+   std::condition_variable m_wake; ///< Wakes the writer up to stop.
+   bool m_stop;                    ///< Whether the writer must stop.
+
+   /**
+    * @brief The loop run by the writer thread.
+    */
+   void work();
+
+ public:
+   /**
+    * @brief Default constructor; the writer starts stopped.
+    */
+   AutosaveWriter();
+
+   /**
+    * @brief Deleted copy constructor.
+    */
+   AutosaveWriter(AutosaveWriter const &other_) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator.
+    */
+   AutosaveWriter &operator=(AutosaveWriter const &other_) = delete;
+
+   /**
+    * @brief Destructor; writes the last snapshot and stops the writer.
+    */
+   ~AutosaveWriter();
+
+   /**
+    * @brief Starts the writer thread.
+    * @param file_ The file name of the autosave.
+    */
+   void start(std::string const &file_);
+
+   /**
+    * @brief Writes the last snapshot and stops the writer thread.
+    */
+   void stop();
+
+   /**
+    * @brief Check if the writer thread is running.
+    * @return True if the writer was started; otherwise, false.
+    */
+   bool isRunning() const;
+
+   /**
+    * @brief Get the file name of the autosave.
+    * @return The file name given to start().
+    */
+   std::string const &file() const;
+
+   /**
+    * @brief Hands a snapshot of the game to the writer, without waiting.
+    *
+    * Only one thread may submit snapshots. If the queue is full, the snapshot
+    * is held back until the next call to submit() or stop(), and dropped if a
+    * newer one arrives first.
+    *
+    * @param save_ The snapshot.
+    */
+   void submit(Save save_);
+};
+
+#endif /// AUTOSAVE_WRITER_HPP_
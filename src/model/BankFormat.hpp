@@ -0,0 +1,273 @@
+/**
+ * @file BankFormat.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares the layouts of ".sdk" bank files and the packing of boards.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Two layouts are supported, told apart by the first bytes of the file:
+ *
+ * - Version 1 (raw): id (int), version (int) and number of boards (int),
+ *   followed by each `Board` as stored in memory (328 bytes).
+ * - Version 2 (packed): the magic "SDK2", id (int), version (int) and number
+ *   of boards (int), followed by each board as a `PackedBoard` (56 bytes).
+ *
+ * A packed board keeps the id, the absolute value of every cell in a nibble
+ * and one bit per cell telling whether the cell is a given (positive) or part
+ * of the hidden solution (negative).
+ *
+ * Both layouts may end with an index footer (`BankIndex`) that finds a board
+ * from its id without reading the others. When the ids are consecutive the
+ * footer alone is enough (the board with id `first + k` is the k-th board);
+ * otherwise it points to a table of (id, position) pairs sorted by id. Older
+ * readers ignore the footer, since it lies after the last board.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BANK_FORMAT_HPP_
+#define BANK_FORMAT_HPP_
+
+#include "Sudoku.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+/// Magic bytes at the start of a packed bank.
+constexpr char const BANK_MAGIC[4]{'S', 'D', 'K', '2'};
+
+/// Size of the header of a raw bank: id, version and number of boards.
+constexpr size_t const RAW_HEADER_SIZE{3 * sizeof(int)};
+
+/// Size of the header of a packed bank: magic, id, version and boards.
+constexpr size_t const PACKED_HEADER_SIZE{sizeof(BANK_MAGIC) +
+                                          3 * sizeof(int)};
+
+/// Bytes holding the cells of a packed board, two cells per byte.
+constexpr size_t const PACKED_CELLS_SIZE{(CELLS_COUNT + 1) / 2};
+
+/// Bytes holding the given bits of a packed board, one bit per cell.
+constexpr size_t const PACKED_CLUES_SIZE{(CELLS_COUNT + 7) / 8};
+
+/**
+ * @struct PackedBoard
+ * @brief A board as stored in a packed bank.
+ */
+struct PackedBoard {
+   int m_id;                                 ///< Identifier for the board.
+   unsigned char m_cells[PACKED_CELLS_SIZE]; ///< Absolute values, in nibbles.
+   unsigned char m_clues[PACKED_CLUES_SIZE]; ///< Bit set for each given.
+};
+
+static_assert(sizeof(PackedBoard) == 56, "Packed boards must take 56 bytes");
+
+/**
+ * @struct BankHeader
+ * @brief The header of a bank file, whatever its layout.
+ */
+struct BankHeader {
+   BankFormat m_format; ///< Layout of the boards.
+   int m_id;            ///< Identifier for the bank.
+   int m_version;       ///< Version number for the bank.
+   int m_count;         ///< Number of boards in the bank.
+   size_t m_size;       ///< Size of the header in bytes.
+   size_t m_record;     ///< Size of each board record in bytes.
+};
+
+/// Magic bytes closing the index footer of a bank.
+constexpr char const INDEX_MAGIC[4]{'S', 'D', 'K', 'I'};
+
+/**
+ * @struct BankIndexEntry
+ * @brief An entry of the index table: the position of a board id.
+ */
+struct BankIndexEntry {
+   int m_id;       ///< Identifier for the board.
+   int m_position; ///< Position of the board among the records.
+};
+
+/**
+ * @struct BankIndex
+ * @brief The index footer stored in the last bytes of a bank file.
+ */
+struct BankIndex {
+   int m_first_id;           ///< Id of the first board.
+   int m_count;              ///< Number of boards indexed.
+   long long m_table_offset; ///< Offset of the table, or 0 if the ids are
+                             ///< consecutive from m_first_id.
+   char m_magic[4];          ///< INDEX_MAGIC.
+   int m_reserved;           ///< Padding, always 0.
+};
+
+static_assert(sizeof(BankIndex) == 24, "The index footer must take 24 bytes");
+
+/**
+ * @brief Parses the header at the start of a bank file.
+ * @param bytes_ The first bytes of the file.
+ * @param size_ The number of bytes available (at least PACKED_HEADER_SIZE
+ * when the file is that large).
+ * @param header_ Receives the parsed header.
+ * @return True if the bytes hold a header with a non-negative count;
+ * otherwise, false.
+ */
+inline bool parseBankHeader(char const *bytes_, size_t size_,
+                            BankHeader &header_) {
+   if (size_ >= PACKED_HEADER_SIZE &&
+       std::memcmp(bytes_, BANK_MAGIC, sizeof(BANK_MAGIC)) == 0) {
+      header_.m_format = BankPacked;
+      header_.m_size = PACKED_HEADER_SIZE;
+      header_.m_record = sizeof(PackedBoard);
+      bytes_ += sizeof(BANK_MAGIC);
+   } else if (size_ >= RAW_HEADER_SIZE) {
+      header_.m_format = BankRaw;
+      header_.m_size = RAW_HEADER_SIZE;
+      header_.m_record = sizeof(Board);
+   } else {
+      return false;
+   }
+
+   std::memcpy(&header_.m_id, bytes_, sizeof(int));
+   std::memcpy(&header_.m_version, bytes_ + sizeof(int), sizeof(int));
+   std::memcpy(&header_.m_count, bytes_ + 2 * sizeof(int), sizeof(int));
+
+   return header_.m_count >= 0;
+}
+
+/**
+ * @brief Parses the index footer at the end of a bank file.
+ * @param footer_ The last sizeof(BankIndex) bytes of the file.
+ * @param header_ The header of the bank.
+ * @param size_ The size of the file in bytes.
+ * @param index_ Receives the parsed footer.
+ * @return True if the file has a footer that matches the bank; otherwise,
+ * false.
+ */
+inline bool parseBankIndex(char const *footer_, BankHeader const &header_,
+                           size_t size_, BankIndex &index_) {
+   size_t boards_end{header_.m_size +
+                     static_cast<size_t>(header_.m_count) * header_.m_record};
+
+   if (size_ < boards_end + sizeof(BankIndex)) {
+      return false;
+   }
+
+   std::memcpy(&index_, footer_, sizeof(BankIndex));
+
+   if (std::memcmp(index_.m_magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+       index_.m_count != header_.m_count) {
+      return false;
+   }
+
+   // The table must lie between the last board and the footer.
+   if (index_.m_table_offset != 0) {
+      size_t table_end{static_cast<size_t>(index_.m_table_offset) +
+                       static_cast<size_t>(index_.m_count) *
+                           sizeof(BankIndexEntry)};
+
+      return index_.m_table_offset > 0 &&
+             static_cast<size_t>(index_.m_table_offset) >= boards_end &&
+             table_end <= size_ - sizeof(BankIndex);
+   }
+
+   return true;
+}
+
+/**
+ * @brief Builds the index footer of a bank with consecutive ids.
+ * @param first_id_ The id of the first board.
+ * @param count_ The number of boards.
+ * @return The footer, without a table.
+ */
+inline BankIndex makeBankIndex(int first_id_, int count_) {
+   return BankIndex{first_id_,
+                    count_,
+                    0,
+                    {INDEX_MAGIC[0], INDEX_MAGIC[1], INDEX_MAGIC[2],
+                     INDEX_MAGIC[3]},
+                    0};
+}
+
+/**
+ * @brief Writes the index footer of a bank after its last board.
+ * @param file_ The output stream, positioned after the last board.
+ * @param ids_ The id of each board, in file order.
+ */
+inline void writeBankIndex(std::ostream &file_, std::vector<int> const &ids_) {
+   BankIndex index{makeBankIndex(ids_.empty() ? 0 : ids_.front(),
+                                 static_cast<int>(ids_.size()))};
+
+   bool consecutive{true};
+   for (size_t position{0}; position != ids_.size() && consecutive;
+        ++position) {
+      consecutive =
+          ids_[position] == index.m_first_id + static_cast<int>(position);
+   }
+
+   // Ids out of order need a table sorted by id.
+   if (!consecutive) {
+      std::vector<BankIndexEntry> table(ids_.size());
+
+      for (size_t position{0}; position != ids_.size(); ++position) {
+         table[position] = {ids_[position], static_cast<int>(position)};
+      }
+
+      std::sort(table.begin(), table.end(),
+                [](BankIndexEntry const &left_, BankIndexEntry const &right_) {
+                   return left_.m_id < right_.m_id;
+                });
+
+      index.m_table_offset = static_cast<long long>(file_.tellp());
+      file_.write(reinterpret_cast<char const *>(table.data()),
+                  table.size() * sizeof(BankIndexEntry));
+   }
+
+   file_.write(reinterpret_cast<char const *>(&index), sizeof(index));
+}
+
+/**
+ * @brief Packs a board; values must lie between -9 and 9.
+ * @param board_ The board to pack.
+ * @return The packed board.
+ */
+inline PackedBoard packBoard(Board const &board_) {
+   PackedBoard packed{board_.m_id, {0}, {0}};
+   int const *values{&board_.m_values[0][0]};
+
+   for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+      int value{values[cell]};
+      unsigned absolute{static_cast<unsigned>(value < 0 ? -value : value)};
+
+      packed.m_cells[cell >> 1] |= (absolute & 0xF) << ((cell & 1) << 2);
+
+      if (value > 0) {
+         packed.m_clues[cell >> 3] |= 1u << (cell & 7);
+      }
+   }
+
+   return packed;
+}
+
+/**
+ * @brief Unpacks a board.
+ * @param packed_ The packed board.
+ * @return The board, with givens positive and hidden values negative.
+ */
+inline Board unpackBoard(PackedBoard const &packed_) {
+   Board board;
+   board.m_id = packed_.m_id;
+   int *values{&board.m_values[0][0]};
+
+   for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+      int value{(packed_.m_cells[cell >> 1] >> ((cell & 1) << 2)) & 0xF};
+      bool given{((packed_.m_clues[cell >> 3] >> (cell & 7)) & 1) != 0};
+
+      values[cell] = given ? value : -value;
+   }
+
+   return board;
+}
+
+#endif /// BANK_FORMAT_HPP_
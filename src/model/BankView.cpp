@@ -0,0 +1,193 @@
+/**
+ * @file BankView.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the memory-mapped bank view.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "BankView.hpp"
+#include <algorithm>
+#include <cstring>
+
+/// @brief Default constructor for the BankView class.
+BankView::BankView()
+    : m_format{BankRaw}, m_id{0}, m_version{0}, m_size{0},
+      m_records{nullptr}, m_index{}, m_indexed{false} {}
+
+/// @brief Opens a bank file, closing the previous one.
+/// @param file_ The file name of the bank.
+/// @return True if the file holds a complete bank; otherwise, false.
+bool BankView::open(std::string const &file_) {
+   close();
+
+   BankHeader header;
+
+   if (!m_file.open(file_) ||
+       !parseBankHeader(m_file.data(), m_file.size(), header)) {
+      close();
+      return false;
+   }
+
+   // A truncated file means a corrupt bank.
+   if (static_cast<size_t>(header.m_count) >
+       (m_file.size() - header.m_size) / header.m_record) {
+      close();
+      return false;
+   }
+
+   // The headers keep the records aligned inside the page-aligned mapping.
+   static_assert(RAW_HEADER_SIZE % alignof(Board) == 0 &&
+                     PACKED_HEADER_SIZE % alignof(PackedBoard) == 0,
+                 "Boards must stay aligned after the bank header");
+
+   m_format = header.m_format;
+   m_id = header.m_id;
+   m_version = header.m_version;
+   m_size = static_cast<size_t>(header.m_count);
+   m_records = m_file.data() + header.m_size;
+   m_indexed = parseBankIndex(m_file.data() + m_file.size() -
+                                  std::min(m_file.size(), sizeof(BankIndex)),
+                              header, m_file.size(), m_index);
+
+   return true;
+}
+
+/// @brief Closes the bank file, leaving the view empty.
+void BankView::close() {
+   m_file.close();
+   m_format = BankRaw;
+   m_id = 0;
+   m_version = 0;
+   m_size = 0;
+   m_records = nullptr;
+   m_indexed = false;
+}
+
+/// @brief Get the bank identifier.
+/// @return The identifier of the bank.
+int BankView::id() const { return m_id; }
+
+/// @brief Get the bank version.
+/// @return The version number of the bank.
+int BankView::version() const { return m_version; }
+
+/// @brief Get the layout of the boards in the file.
+/// @return The format of the bank.
+BankFormat BankView::format() const { return m_format; }
+
+/// @brief Get the number of boards.
+/// @return The number of boards in the bank.
+size_t BankView::size() const { return m_size; }
+
+/// @brief Check if the bank has no boards.
+/// @return True if there are no boards; otherwise, false.
+bool BankView::empty() const { return m_size == 0; }
+
+/// @brief Get the boards of a raw bank as a contiguous span.
+/// @return A pointer to the first board, or nullptr if the bank is packed.
+Board const *BankView::data() const {
+   return m_format == BankRaw ? reinterpret_cast<Board const *>(m_records)
+                              : nullptr;
+}
+
+/// @brief Get an iterator to the first board.
+/// @return An iterator to the first board.
+BankView::Iterator BankView::begin() const { return Iterator{this, 0}; }
+
+/// @brief Get an iterator past the last board.
+/// @return An iterator one past the last board.
+BankView::Iterator BankView::end() const { return Iterator{this, m_size}; }
+
+/// @brief Access a board by its position.
+/// @param index_ The position of the board.
+/// @return A copy of the board, unpacked if needed.
+Board BankView::operator[](size_t index_) const {
+   if (m_format == BankRaw) {
+      return reinterpret_cast<Board const *>(m_records)[index_];
+   }
+
+   return unpackBoard(
+       reinterpret_cast<PackedBoard const *>(m_records)[index_]);
+}
+
+/// @brief Get the id of a board record, without unpacking it.
+/// @param records_ The first board record.
+/// @param record_ The size of each record.
+/// @param index_ The position of the board.
+/// @return The id of the board.
+static int recordId(char const *records_, size_t record_, size_t index_) {
+   int id{0};
+   std::memcpy(&id, records_ + index_ * record_, sizeof(id));
+   return id;
+}
+
+/// @brief Finds the position of a board from its id.
+/// @param id_ The id of the board.
+/// @return A pair indicating success (true/false) and the position.
+std::pair<bool, size_t> BankView::indexOf(int id_) const {
+   size_t record{m_format == BankRaw ? sizeof(Board) : sizeof(PackedBoard)};
+
+   if (m_indexed && m_index.m_table_offset != 0) {
+      // Binary search the table of ids.
+      char const *table{m_file.data() + m_index.m_table_offset};
+      size_t low{0};
+      size_t high{m_size};
+
+      while (low < high) {
+         size_t middle{low + (high - low) / 2};
+         BankIndexEntry entry;
+         std::memcpy(&entry, table + middle * sizeof(entry), sizeof(entry));
+
+         if (entry.m_id == id_) {
+            bool valid{entry.m_position >= 0 &&
+                       static_cast<size_t>(entry.m_position) < m_size};
+            return {valid, static_cast<size_t>(entry.m_position)};
+         } else if (entry.m_id < id_) {
+            low = middle + 1;
+         } else {
+            high = middle;
+         }
+      }
+
+      return {false, 0};
+   }
+
+   // Consecutive ids: the position follows from the id of the first board.
+   if (m_size != 0) {
+      int first{m_indexed ? m_index.m_first_id
+                          : recordId(m_records, record, 0)};
+      long long position{static_cast<long long>(id_) - first};
+
+      if (position >= 0 && static_cast<size_t>(position) < m_size &&
+          recordId(m_records, record, static_cast<size_t>(position)) == id_) {
+         return {true, static_cast<size_t>(position)};
+      }
+   }
+
+   // Without an index, scan the ids of the records.
+   if (!m_indexed) {
+      for (size_t position{0}; position != m_size; ++position) {
+         if (recordId(m_records, record, position) == id_) {
+            return {true, position};
+         }
+      }
+   }
+
+   return {false, 0};
+}
+
+/// @brief Copies the whole view into a Bank.
+/// @return A Bank holding a copy of every board.
+Bank BankView::toBank() const {
+   Bank bank{m_id, m_version, {}};
+   bank.m_boards.reserve(m_size);
+
+   for (size_t index{0}; index != m_size; ++index) {
+      bank.m_boards.push_back((*this)[index]);
+   }
+
+   return bank;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file BankView.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares a read-only view of a ".sdk" bank mapped from its file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * A ".sdk" file stores the id, the version and the number of boards of the
+ * bank followed by the board records (see BankFormat.hpp). The view maps the
+ * file and reads the boards in place, so opening costs the same whatever the
+ * size of the bank and only the boards that are used are ever paged in. Raw
+ * banks are exposed as a span of `Board`; packed boards are unpacked one at a
+ * time when they are accessed.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BANK_VIEW_HPP_
+#define BANK_VIEW_HPP_
+
+#include "BankFormat.hpp"
+#include "Sudoku.hpp"
+#include "explorer/MappedFile.hpp"
+#include <iterator>
+#include <string>
+#include <utility>
+
+/**
+ * @class BankView
+ * @brief A read-only bank whose boards live in a memory-mapped file.
+ */
+class BankView {
+ private:
+   ext::MappedFile m_file; ///< The mapped ".sdk" file.
+   BankFormat m_format;    ///< Layout of the boards in the file.
+   int m_id;               ///< Identifier for the bank.
+   int m_version;          ///< Version number for the bank.
+   size_t m_size;          ///< Number of boards in the bank.
+   char const *m_records;  ///< First board record, inside the mapping.
+   BankIndex m_index;      ///< The index footer, if m_indexed.
+   bool m_indexed;         ///< Whether the file has an index footer.
+
+ public:
+   /**
+    * @class Iterator
+    * @brief Walks the boards of the view, yielding them by value.
+    */
+   class Iterator {
+    private:
+      BankView const *m_view; ///< The view being walked.
+      size_t m_index;         ///< Position of the current board.
+
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = Board;
+      using difference_type = std::ptrdiff_t;
+      using pointer = Board const *;
+      using reference = Board;
+
+      /**
+       * @brief Constructor for the Iterator class.
+       * @param view_ The view to walk.
+       * @param index_ Position of the first board.
+       */
+      Iterator(BankView const *view_, size_t index_)
+          : m_view{view_}, m_index{index_} {}
+
+      /**
+       * @brief Get the current board.
+       * @return A copy of the board.
+       */
+      Board operator*() const { return (*m_view)[m_index]; }
+
+      /**
+       * @brief Moves to the next board.
+       * @return A reference to this iterator.
+       */
+      Iterator &operator++() {
+         ++m_index;
+         return *this;
+      }
+
+      /**
+       * @brief Compare two iterators for equality.
+       * @param other_ The other iterator.
+       * @return True if both point to the same board; otherwise, false.
+       */
+      bool operator==(Iterator const &other_) const {
+         return m_index == other_.m_index;
+      }
+
+      /**
+       * @brief Compare two iterators for inequality.
+       * @param other_ The other iterator.
+       * @return True if they point to different boards; otherwise, false.
+       */
+      bool operator!=(Iterator const &other_) const {
+         return m_index != other_.m_index;
+      }
+   };
+
+   /**
+    * @brief Default constructor; the view starts empty.
+    */
+   BankView();
+
+   /**
+    * @brief Opens a bank file, closing the previous one.
+    * @param file_ The file name of the bank.
+    * @return True if the file holds a complete bank; otherwise, false and the
+    * view is left empty.
+    */
+   bool open(std::string const &file_);
+
+   /**
+    * @brief Closes the bank file, leaving the view empty.
+    */
+   void close();
+
+   /**
+    * @brief Get the bank identifier.
+    * @return The identifier of the bank.
+    */
+   int id() const;
+
+   /**
+    * @brief Get the bank version.
+    * @return The version number of the bank.
+    */
+   int version() const;
+
+   /**
+    * @brief Get the layout of the boards in the file.
+    * @return The format of the bank.
+    */
+   BankFormat format() const;
+
+   /**
+    * @brief Get the number of boards.
+    * @return The number of boards in the bank.
+    */
+   size_t size() const;
+
+   /**
+    * @brief Check if the bank has no boards.
+    * @return True if there are no boards; otherwise, false.
+    */
+   bool empty() const;
+
+   /**
+    * @brief Get the boards of a raw bank as a contiguous span.
+    * @return A pointer to the first board, or nullptr if the bank is packed.
+    */
+   Board const *data() const;
+
+   /**
+    * @brief Get an iterator to the first board.
+    * @return An iterator to the first board.
+    */
+   Iterator begin() const;
+
+   /**
+    * @brief Get an iterator past the last board.
+    * @return An iterator one past the last board.
+    */
+   Iterator end() const;
+
+   /**
+    * @brief Access a board by its position.
+    * @param index_ The position of the board, less than size().
+    * @return A copy of the board, unpacked if needed.
+    */
+   Board operator[](size_t index_) const;
+
+   /**
+    * @brief Finds the position of a board from its id.
+    *
+    * Uses the index footer of the file when there is one. Without it, the
+    * position implied by consecutive ids is tried before scanning the bank.
+    *
+    * @param id_ The id of the board.
+    * @return A pair indicating success (true/false) and the position.
+    */
+   std::pair<bool, size_t> indexOf(int id_) const;
+
+   /**
+    * @brief Copies the whole view into a Bank.
+    * @return A Bank holding a copy of every board.
+    */
+   Bank toBank() const;
+};
+
+#endif /// BANK_VIEW_HPP_
@@ -0,0 +1,142 @@
+/**
+ * @file BankWriter.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the streaming bank writer.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "BankWriter.hpp"
+#include <cstdio>
+
+/// @brief Default constructor for the BankWriter class.
+BankWriter::BankWriter()
+    : m_format{BankPacked}, m_count{0}, m_first_id{0}, m_consecutive{true} {}
+
+/// @brief Destructor for the BankWriter class.
+BankWriter::~BankWriter() { close(); }
+
+/// @brief Creates a temporary bank file and writes its header.
+/// @param file_ The file name of the bank.
+/// @param id_ Identifier for the bank.
+/// @param version_ Version number for the bank.
+/// @param format_ The layout of the boards.
+/// @return True if the file was created; otherwise, false.
+bool BankWriter::open(std::string const &file_, int id_, int version_,
+                      BankFormat format_) {
+   close();
+
+   // Copy the name first: it may be m_name itself.
+   std::string name{file_};
+   m_file.open(name + ".tmp",
+               std::ios::out | std::ios::binary | std::ios::trunc);
+
+   if (!m_file.is_open()) {
+      return false;
+   }
+
+   m_name = name;
+
+   m_format = format_;
+   m_count = 0;
+   m_first_id = 0;
+   m_consecutive = true;
+   m_ids.clear();
+
+   // Packed banks start with a magic to tell them from raw banks.
+   if (m_format == BankPacked) {
+      m_file.write(BANK_MAGIC, sizeof(BANK_MAGIC));
+   }
+
+   // The count is patched by close(), once it is known.
+   int count{0};
+   m_file.write(reinterpret_cast<char const *>(&id_), sizeof(id_));
+   m_file.write(reinterpret_cast<char const *>(&version_), sizeof(version_));
+   m_file.write(reinterpret_cast<char const *>(&count), sizeof(count));
+
+   return static_cast<bool>(m_file);
+}
+
+/// @brief Appends a board to the bank.
+/// @param board_ The board to append.
+/// @return True if the board was written; otherwise, false.
+bool BankWriter::append(Board const &board_) {
+   if (!m_file.is_open()) {
+      return false;
+   }
+
+   if (m_count == 0) {
+      m_first_id = board_.m_id;
+   } else if (m_consecutive && board_.m_id != m_first_id + m_count) {
+      // From now on the index needs a table: recall the previous ids.
+      m_consecutive = false;
+      m_ids.reserve(static_cast<size_t>(m_count) + 1);
+
+      for (int position{0}; position != m_count; ++position) {
+         m_ids.push_back(m_first_id + position);
+      }
+   }
+
+   if (!m_consecutive) {
+      m_ids.push_back(board_.m_id);
+   }
+
+   if (m_format == BankRaw) {
+      m_file.write(reinterpret_cast<char const *>(&board_), sizeof(board_));
+   } else {
+      PackedBoard packed{packBoard(board_)};
+      m_file.write(reinterpret_cast<char const *>(&packed), sizeof(packed));
+   }
+
+   ++m_count;
+   return static_cast<bool>(m_file);
+}
+
+/// @brief Writes the index footer, patches the count, closes the file and
+/// renames it over the bank.
+/// @return True if everything was written; otherwise, false.
+bool BankWriter::close() {
+   if (!m_file.is_open()) {
+      return false;
+   }
+
+   // Close the file with the index that finds boards by id.
+   if (m_consecutive) {
+      BankIndex index{makeBankIndex(m_first_id, m_count)};
+      m_file.write(reinterpret_cast<char const *>(&index), sizeof(index));
+   } else {
+      writeBankIndex(m_file, m_ids);
+   }
+
+   // Patch the count, the last field of the header.
+   size_t header_size{m_format == BankPacked ? PACKED_HEADER_SIZE
+                                             : RAW_HEADER_SIZE};
+   m_file.seekp(header_size - sizeof(m_count));
+   m_file.write(reinterpret_cast<char const *>(&m_count), sizeof(m_count));
+
+   bool written{static_cast<bool>(m_file)};
+   m_file.close();
+   m_ids.clear();
+   m_ids.shrink_to_fit();
+
+   // Replace the previous bank only once the new one is complete.
+   std::string temporary{m_name + ".tmp"};
+
+   if (!written || m_file.fail() ||
+       std::rename(temporary.c_str(), m_name.c_str()) != 0) {
+      std::remove(temporary.c_str());
+      return false;
+   }
+
+   return true;
+}
+
+/// @brief Check if the writer has an open file.
+/// @return True if a file is open; otherwise, false.
+bool BankWriter::isOpen() const { return m_file.is_open(); }
+
+/// @brief Get the number of boards written.
+/// @return The number of boards appended since the file was opened.
+int BankWriter::size() const { return m_count; }
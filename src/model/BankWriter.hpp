@@ -0,0 +1,110 @@
+/**
+ * @file BankWriter.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares a writer that streams boards to a ".sdk" bank file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The writer saves the header with a zero count when it is opened, appends
+ * each board as soon as it arrives and, when it is closed, writes the index
+ * footer and patches the count in the header. Only the boards being written
+ * are held in memory, so a bank of any size can be produced with constant
+ * memory as long as the ids are consecutive, which is what the index footer
+ * needs no table for.
+ *
+ * The boards go to a temporary file next to the bank, renamed over it by
+ * close() once everything was written, so a failed run leaves the previous
+ * bank whole.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BANK_WRITER_HPP_
+#define BANK_WRITER_HPP_
+
+#include "BankFormat.hpp"
+#include "Sudoku.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @class BankWriter
+ * @brief Streams boards to a bank file, one at a time.
+ */
+class BankWriter {
+ private:
+   std::ofstream m_file;   ///< The temporary bank file being written.
+   std::string m_name;     ///< The file name of the bank.
+   BankFormat m_format;    ///< Layout of the boards in the file.
+   int m_count;            ///< Number of boards written.
+   int m_first_id;         ///< Id of the first board.
+   bool m_consecutive;     ///< Whether the ids written so far are consecutive.
+   std::vector<int> m_ids; ///< Every id, kept only once they stop being
+                           ///< consecutive.
+
+ public:
+   /**
+    * @brief Default constructor; the writer starts closed.
+    */
+   BankWriter();
+
+   /**
+    * @brief Deleted copy constructor.
+    */
+   BankWriter(BankWriter const &other_) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator.
+    */
+   BankWriter &operator=(BankWriter const &other_) = delete;
+
+   /**
+    * @brief Destructor; closes the file if it is still open.
+    */
+   ~BankWriter();
+
+   /**
+    * @brief Creates a temporary bank file and writes its header.
+    * @param file_ The file name of the bank.
+    * @param id_ Identifier for the bank.
+    * @param version_ Version number for the bank.
+    * @param format_ The layout of the boards (packed by default).
+    * @return True if the file was created; otherwise, false.
+    */
+   bool open(std::string const &file_, int id_, int version_,
+             BankFormat format_ = BankPacked);
+
+   /**
+    * @brief Appends a board to the bank.
+    * @param board_ The board to append.
+    * @return True if the board was written; otherwise, false.
+    */
+   bool append(Board const &board_);
+
+   /**
+    * @brief Writes the index footer, patches the count, closes the file and
+    * renames it over the bank.
+    *
+    * If a write failed, the temporary file is removed and the bank is left as
+    * it was.
+    *
+    * @return True if everything was written; otherwise, false.
+    */
+   bool close();
+
+   /**
+    * @brief Check if the writer has an open file.
+    * @return True if a file is open; otherwise, false.
+    */
+   bool isOpen() const;
+
+   /**
+    * @brief Get the number of boards written.
+    * @return The number of boards appended since the file was opened.
+    */
+   int size() const;
+};
+
+#endif /// BANK_WRITER_HPP_
@@ -0,0 +1,78 @@
+/**
+ * @file Mask.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Helpers for 9-bit digit masks over the Sudoku grid.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * A digit mask stores one bit per digit: bit 0 stands for digit 1 and bit 8
+ * for digit 9. Rows, columns and blocks keep such a mask to answer "is this
+ * digit already used here?" without rescanning the grid.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MASK_HPP_
+#define MASK_HPP_
+
+/// Size of a Sudoku block (3x3).
+constexpr int const BLOCK_SIZE{3};
+
+/// Mask with the bits of all nine digits set.
+constexpr unsigned short const FULL_MASK{0x1FF};
+
+/**
+ * @brief Get the mask bit of a digit.
+ * @param value_ The digit (1-9).
+ * @return The mask with only the digit bit set.
+ */
+constexpr unsigned short digitMask(int value_) {
+   return static_cast<unsigned short>(1u << (value_ - 1));
+}
+
+/**
+ * @brief Get the index of the block that contains a cell.
+ * @param row_ The zero-based row of the cell.
+ * @param column_ The zero-based column of the cell.
+ * @return The zero-based block index, numbered left to right, top to bottom.
+ */
+constexpr int blockIndex(int row_, int column_) {
+   return (row_ / BLOCK_SIZE) * BLOCK_SIZE + column_ / BLOCK_SIZE;
+}
+
+/**
+ * @brief Count the digits present in a mask.
+ * @param mask_ The digit mask.
+ * @return The number of bits set.
+ */
+inline int countDigits(unsigned mask_) {
+#if defined(__GNUC__)
+   return __builtin_popcount(mask_);
+#else
+   int count{0};
+   for (; mask_ != 0; mask_ &= mask_ - 1) {
+      ++count;
+   }
+   return count;
+#endif
+}
+
+/**
+ * @brief Get the lowest digit present in a mask.
+ * @param mask_ The digit mask (must not be empty).
+ * @return The lowest digit (1-9) of the mask.
+ */
+inline int lowestDigit(unsigned mask_) {
+#if defined(__GNUC__)
+   return __builtin_ctz(mask_) + 1;
+#else
+   int value{1};
+   for (; (mask_ & 1u) == 0; mask_ >>= 1) {
+      ++value;
+   }
+   return value;
+#endif
+}
+
+#endif /// MASK_HPP_
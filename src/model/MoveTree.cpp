@@ -0,0 +1,143 @@
+/**
+ * @file MoveTree.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the tree of moves of a Sudoku game.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "MoveTree.hpp"
+
+/// @brief Default constructor for the MoveTree class.
+MoveTree::MoveTree() : m_cursor{0} { clear(); }
+
+/// @brief Removes every move, leaving only the root.
+void MoveTree::clear() {
+   m_nodes.clear();
+   m_nodes.push_back({ActionGame{}, -1, -1, -1, -1, 0});
+   m_cursor = 0;
+}
+
+/// @brief Reserves room for a number of moves.
+/// @param moves_ The number of moves.
+void MoveTree::reserve(size_t moves_) {
+   m_nodes.reserve(m_nodes.size() + moves_);
+}
+
+/// @brief Plays a move from the current position.
+/// @param action_ The move played.
+void MoveTree::push(ActionGame const &action_) {
+   // Follow the branch of the same move if it was already played from here.
+   for (int child{m_nodes[m_cursor].m_first_child}; child != -1;
+        child = m_nodes[child].m_next_sibling) {
+      ActionGame const &played{m_nodes[child].m_action};
+
+      if (played.m_x == action_.m_x && played.m_y == action_.m_y &&
+          played.m_value == action_.m_value &&
+          played.m_action == action_.m_action) {
+         m_nodes[m_cursor].m_preferred = child;
+         m_cursor = child;
+         return;
+      }
+   }
+
+   int node{static_cast<int>(m_nodes.size())};
+   MoveNode &parent{m_nodes[m_cursor]};
+
+   // The new move becomes the first child of the current one.
+   MoveNode added{action_,     m_cursor, -1, parent.m_first_child, -1,
+                  parent.m_depth + 1};
+   parent.m_first_child = node;
+   parent.m_preferred = node;
+
+   m_nodes.push_back(added);
+   m_cursor = node;
+}
+
+/// @brief Moves the cursor back to the previous move.
+/// @param action_ Receives the move taken back.
+/// @return True if there was a move to take back; otherwise, false.
+bool MoveTree::undo(ActionGame &action_) {
+   if (m_cursor == 0) {
+      return false;
+   }
+
+   MoveNode const &node{m_nodes[m_cursor]};
+   action_ = node.m_action;
+
+   // Redo comes back to the branch being left.
+   m_nodes[node.m_parent].m_preferred = m_cursor;
+   m_cursor = node.m_parent;
+   return true;
+}
+
+/// @brief Moves the cursor forward along the last branch visited.
+/// @param action_ Receives the move played again.
+/// @return True if there was a move to play again; otherwise, false.
+bool MoveTree::redo(ActionGame &action_) {
+   int next{m_nodes[m_cursor].m_preferred};
+
+   if (next == -1) {
+      return false;
+   }
+
+   action_ = m_nodes[next].m_action;
+   m_cursor = next;
+   return true;
+}
+
+/// @brief Replaces the current move by the next move played from the same
+/// position, cycling through them.
+/// @param undone_ Receives the move taken back.
+/// @param played_ Receives the move played instead.
+/// @return True if there was another branch; otherwise, false.
+bool MoveTree::switchBranch(ActionGame &undone_, ActionGame &played_) {
+   if (m_cursor == 0) {
+      return false;
+   }
+
+   MoveNode const &node{m_nodes[m_cursor]};
+   MoveNode &parent{m_nodes[node.m_parent]};
+   int sibling{node.m_next_sibling != -1 ? node.m_next_sibling
+                                         : parent.m_first_child};
+
+   if (sibling == m_cursor) {
+      return false; // The only move played from here.
+   }
+
+   undone_ = node.m_action;
+   played_ = m_nodes[sibling].m_action;
+
+   parent.m_preferred = sibling;
+   m_cursor = sibling;
+   return true;
+}
+
+/// @brief Check if no move led to the current position.
+/// @return True if the cursor is at the root; otherwise, false.
+bool MoveTree::empty() const { return m_cursor == 0; }
+
+/// @brief Get the move that led to the current position.
+/// @return The last move played.
+ActionGame const &MoveTree::last() const { return m_nodes[m_cursor].m_action; }
+
+/// @brief Get the number of moves that led to the current position.
+/// @return The depth of the cursor.
+size_t MoveTree::depth() const {
+   return static_cast<size_t>(m_nodes[m_cursor].m_depth);
+}
+
+/// @brief Get the moves that led to the current position.
+/// @return The moves from the first to the current one.
+std::vector<ActionGame> MoveTree::path() const {
+   std::vector<ActionGame> actions(depth());
+
+   // Walk up from the cursor, filling the list from its end.
+   for (int node{m_cursor}; node != 0; node = m_nodes[node].m_parent) {
+      actions[m_nodes[node].m_depth - 1] = m_nodes[node].m_action;
+   }
+
+   return actions;
+}
@@ -0,0 +1,125 @@
+/**
+ * @file MoveTree.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares the tree of moves played in a Sudoku game.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Every move is a node whose parent is the move played before it, so playing
+ * a different move after an undo starts a new branch instead of discarding
+ * the undone moves. A cursor marks the node of the current position; the path
+ * from the root to the cursor is the list of actions that led to the board.
+ *
+ * The nodes live in a single vector and refer to each other by index, so
+ * adding a move costs one append and undo, redo and branch switches only move
+ * the cursor.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MOVE_TREE_HPP_
+#define MOVE_TREE_HPP_
+
+#include "Actions.hpp"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct MoveNode
+ * @brief A move of the tree and its links to the other moves.
+ */
+struct MoveNode {
+   ActionGame m_action; ///< The move played.
+   int m_parent;        ///< The move played before, or -1 for the root.
+   int m_first_child;   ///< The most recent move played after, or -1.
+   int m_next_sibling;  ///< The next move played from the same parent, or -1.
+   int m_preferred;     ///< The child that redo follows, or -1.
+   int m_depth;         ///< Number of moves from the root.
+};
+
+/**
+ * @class MoveTree
+ * @brief The moves of a game, with every branch kept, and a cursor.
+ */
+class MoveTree {
+ private:
+   std::vector<MoveNode> m_nodes; ///< Every node; the root is the first one.
+   int m_cursor;                  ///< Node of the current position.
+
+ public:
+   /**
+    * @brief Default constructor; the tree holds only the root.
+    */
+   MoveTree();
+
+   /**
+    * @brief Removes every move, leaving only the root.
+    */
+   void clear();
+
+   /**
+    * @brief Reserves room for a number of moves, so pushing them does not
+    * allocate.
+    * @param moves_ The number of moves.
+    */
+   void reserve(size_t moves_);
+
+   /**
+    * @brief Plays a move from the current position.
+    *
+    * If the same move was already played from here, its branch is reused.
+    *
+    * @param action_ The move played.
+    */
+   void push(ActionGame const &action_);
+
+   /**
+    * @brief Moves the cursor back to the previous move.
+    * @param action_ Receives the move taken back.
+    * @return True if there was a move to take back; otherwise, false.
+    */
+   bool undo(ActionGame &action_);
+
+   /**
+    * @brief Moves the cursor forward along the last branch visited.
+    * @param action_ Receives the move played again.
+    * @return True if there was a move to play again; otherwise, false.
+    */
+   bool redo(ActionGame &action_);
+
+   /**
+    * @brief Replaces the current move by the next move played from the same
+    * position, cycling through them.
+    * @param undone_ Receives the move taken back.
+    * @param played_ Receives the move played instead.
+    * @return True if there was another branch; otherwise, false.
+    */
+   bool switchBranch(ActionGame &undone_, ActionGame &played_);
+
+   /**
+    * @brief Check if no move led to the current position.
+    * @return True if the cursor is at the root; otherwise, false.
+    */
+   bool empty() const;
+
+   /**
+    * @brief Get the move that led to the current position.
+    * @return The last move played; only meaningful if the tree is not empty().
+    */
+   ActionGame const &last() const;
+
+   /**
+    * @brief Get the number of moves that led to the current position.
+    * @return The depth of the cursor.
+    */
+   size_t depth() const;
+
+   /**
+    * @brief Get the moves that led to the current position.
+    * @return The moves from the first to the current one.
+    */
+   std::vector<ActionGame> path() const;
+};
+
+#endif /// MOVE_TREE_HPP_
@@ -18,45 +18,30 @@
  */
 
 #include "Save.hpp"
+#include "SaveJournal.hpp"
+#include <cstring>
 #include <fstream>
 
-/// @brief Saves a Sudoku game state to a binary file.
+/// @brief Saves a Sudoku game state to a binary file, as a compact journal.
 /// @param save_ The Sudoku game state to be saved.
 /// @param file_ The filename for the saved game file.
 void saveGameToFile(Save const &save_, std::string file_) {
-   // Open the binary file for writing.
-   std::ofstream file{file_, std::ios::out | std::ios::binary};
-
-   // Extract various components from the game state.
-   int bank_id{save_.m_bank_id};
-   int version{save_.m_bank_version};
-   int board_id{save_.m_board_id};
-   int checks{save_.m_checks};
-   int quant_of_actions{static_cast<int>(save_.m_actions.size())};
-
-   // Write bank-related information to the file.
-   file.write(reinterpret_cast<char *>(&bank_id), sizeof(bank_id));
-   file.write(reinterpret_cast<char *>(&version), sizeof(version));
-   file.write(reinterpret_cast<char *>(&board_id), sizeof(board_id));
-
-   // Write the number of checks and the quantity of game actions to the file.
-   file.write(reinterpret_cast<char *>(&checks), sizeof(checks));
-   file.write(reinterpret_cast<char *>(&quant_of_actions),
-              sizeof(quant_of_actions));
-
-   // Write each game action to the file.
-   for (ActionGame action : save_.m_actions) {
-      file.write(reinterpret_cast<char *>(&action), sizeof(action));
-   }
-
-   // Close the file after writing the game state.
-   file.close();
+   SaveJournal journal;
+   journal.create(file_, save_);
 }
 
 /// @brief Reads a saved Sudoku game state from a binary file.
 /// @param file_ The filename of the saved game file.
 /// @return The loaded Sudoku game state.
 Save readGameFromFile(std::string file_) {
+   // Journals tell themselves apart by their magic; other files use the
+   // original layout.
+   if (isJournalFile(file_)) {
+      Save journal_save{};
+      readJournal(file_, journal_save);
+      return journal_save;
+   }
+
    // Open the binary file for reading.
    std::ifstream file{file_, std::ios::in | std::ios::binary};
 
@@ -90,3 +75,38 @@ Save readGameFromFile(std::string file_) {
 
    return save_game; // Return the loaded game state.
 }
+
+/// @brief Reads only the bank and board of a saved game, from the first bytes
+/// of its file.
+/// @param file_ The filename of the saved game file.
+/// @return A pair with true and the bank and board of the game if the file
+/// starts like a save; otherwise, false.
+std::pair<bool, Save> readSaveHeader(std::string const &file_) {
+   Save save_game{};
+
+   // Read once the bytes that hold the header of any layout.
+   std::ifstream file{file_, std::ios::in | std::ios::binary};
+   unsigned char bytes[JOURNAL_HEADER_BYTES]{0};
+   file.read(reinterpret_cast<char *>(bytes), sizeof(bytes));
+   size_t size{static_cast<size_t>(file.gcount())};
+
+   if (size >= sizeof(JOURNAL_MAGIC) &&
+       std::memcmp(bytes, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) == 0) {
+      bool read{readJournalHeader(bytes, size, save_game)};
+      return {read, save_game};
+   }
+
+   // The original layout starts with the bank id and version, the board id,
+   // the checks and the number of actions.
+   int header[5]{0};
+
+   if (size < sizeof(header)) {
+      return {false, save_game};
+   }
+
+   std::memcpy(header, bytes, sizeof(header));
+   save_game.m_bank_id = header[0];
+   save_game.m_bank_version = header[1];
+   save_game.m_board_id = header[2];
+   return {true, save_game};
+}
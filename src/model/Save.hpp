@@ -20,6 +20,7 @@
 
 #include "Actions.hpp"
 #include <string>
+#include <utility>
 #include <vector>
 
 struct Save {
@@ -33,17 +34,28 @@ struct Save {
 };
 
 /**
- * @brief Saves a game state to a file.
+ * @brief Saves a game state to a file, as a compact journal.
+ * @see SaveJournal.hpp
  * @param save_ The game state to be saved.
  * @param file_ The filename for the saved game file.
  */
 void saveGameToFile(Save const &save_, std::string file_);
 
 /**
- * @brief Reads a game state from a file.
+ * @brief Reads a game state from a file, either a journal or a file in the
+ * original layout (the header followed by every action).
  * @param file_ The filename of the saved game file.
  * @return The game state loaded from the file.
  */
 Save readGameFromFile(std::string file_);
 
+/**
+ * @brief Reads only the bank and board of a saved game, from the first bytes
+ * of its file; the actions and checks are left empty.
+ * @param file_ The filename of the saved game file.
+ * @return A pair with true and the bank and board of the game if the file
+ * starts like a save; otherwise, false.
+ */
+std::pair<bool, Save> readSaveHeader(std::string const &file_);
+
 #endif /// SAVE_HPP_
@@ -0,0 +1,222 @@
+/**
+ * @file SaveIndex.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the index of save files.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "SaveIndex.hpp"
+#include "parallel/WorkStealingPool.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+namespace fs = std::filesystem;
+
+/// @brief Default constructor for the SaveIndex class.
+SaveIndex::SaveIndex() : m_changed{false} {}
+
+/// @brief Get the modification time and size of a save file.
+/// @param save_ The path of the save.
+/// @return A pair with true and an entry holding only the time and size if the
+/// file exists; otherwise, false.
+std::pair<bool, SaveIndexEntry> SaveIndex::stamp(std::string const &save_) {
+   SaveIndexEntry entry{};
+   std::error_code error;
+
+   fs::file_time_type modified{fs::last_write_time(save_, error)};
+
+   if (error) {
+      return {false, entry};
+   }
+
+   std::uintmax_t size{fs::file_size(save_, error)};
+
+   if (error) {
+      return {false, entry};
+   }
+
+   entry.m_modified =
+       static_cast<long long>(modified.time_since_epoch().count());
+   entry.m_size = static_cast<unsigned long long>(size);
+   return {true, entry};
+}
+
+/// @brief Reads the entry of a save from its file.
+/// @param save_ The path of the save.
+/// @return A pair with true and the entry if the file could be stamped;
+/// otherwise, false and the entry, to be read again next time.
+std::pair<bool, SaveIndexEntry> SaveIndex::readEntry(std::string const &save_) {
+   // Stamp first: a file changed while it is read gets read again next time.
+   std::pair<bool, SaveIndexEntry> entry{stamp(save_)};
+   std::pair<bool, Save> header{readSaveHeader(save_)};
+
+   entry.second.m_bank_id = header.second.m_bank_id;
+   entry.second.m_bank_version = header.second.m_bank_version;
+   entry.second.m_board_id = header.second.m_board_id;
+   entry.second.m_valid = header.first;
+   return entry;
+}
+
+/// @brief Reads an index, replacing the entries.
+/// @param file_ The file name of the index.
+/// @return True if the file is an index; otherwise, false.
+bool SaveIndex::load(std::string const &file_) {
+   m_file = file_;
+   m_entries.clear();
+   m_changed = false;
+
+   std::ifstream file{file_};
+   std::string line;
+
+   if (!std::getline(file, line) || line != SAVE_INDEX_HEADER) {
+      // Nothing to reuse: write a new index on the next store().
+      m_changed = true;
+      return false;
+   }
+
+   while (std::getline(file, line)) {
+      std::istringstream fields{line};
+      SaveIndexEntry entry{};
+      int valid{0};
+      std::string path;
+
+      fields >> entry.m_modified >> entry.m_size >> entry.m_bank_id >>
+          entry.m_bank_version >> entry.m_board_id >> valid;
+
+      // The path is the rest of the line, after a single space.
+      if (!fields || fields.get() != ' ' || !std::getline(fields, path) ||
+          path.empty()) {
+         m_changed = true; // Drop the damaged line.
+         continue;
+      }
+
+      entry.m_valid = valid != 0;
+      m_entries[path] = entry;
+   }
+
+   return true;
+}
+
+/// @brief Looks up a save whose file did not change since it was indexed.
+/// @param save_ The path of the save.
+/// @return A pair with true and the entry if it is up to date; otherwise,
+/// false.
+std::pair<bool, SaveIndexEntry>
+SaveIndex::find(std::string const &save_) const {
+   auto found{m_entries.find(save_)};
+
+   if (found == m_entries.end()) {
+      return {false, SaveIndexEntry{}};
+   }
+
+   std::pair<bool, SaveIndexEntry> current{stamp(save_)};
+
+   if (!current.first ||
+       current.second.m_modified != found->second.m_modified ||
+       current.second.m_size != found->second.m_size) {
+      return {false, SaveIndexEntry{}};
+   }
+
+   return {true, found->second};
+}
+
+/// @brief Get the entries of saves, reading the files of those not up to date
+/// in the index and indexing them.
+/// @param saves_ The paths of the saves.
+/// @param threads_ Number of threads (0 uses one per hardware thread).
+/// @return The entries, in the order of saves_.
+std::vector<SaveIndexEntry>
+SaveIndex::scan(std::vector<std::string> const &saves_, unsigned threads_) {
+   std::vector<SaveIndexEntry> entries(saves_.size());
+
+   // Whether each entry was read from its file (1) and can be indexed (2).
+   std::vector<unsigned char> read(saves_.size(), 0);
+
+   auto scanSave{[&](size_t index_, unsigned) {
+      std::pair<bool, SaveIndexEntry> entry{find(saves_[index_])};
+
+      if (!entry.first) {
+         entry = readEntry(saves_[index_]);
+         read[index_] = entry.first ? 2 : 1;
+      }
+
+      entries[index_] = entry.second;
+   }};
+
+   // Waiting on the disk overlaps across threads; few saves are not worth
+   // starting them.
+   if (threads_ == 1 || saves_.size() < SAVE_SCAN_PARALLEL_MIN) {
+      for (size_t index{0}; index != saves_.size(); ++index) {
+         scanSave(index, 0);
+      }
+   } else {
+      ext::WorkStealingPool pool{threads_};
+      pool.run(saves_.size(), scanSave);
+   }
+
+   for (size_t index{0}; index != saves_.size(); ++index) {
+      if (read[index] == 2) {
+         m_entries[saves_[index]] = entries[index];
+         m_changed = true;
+      }
+   }
+
+   return entries;
+}
+
+/// @brief Drops the entries of the saves not listed.
+/// @param saves_ The paths of the saves that still exist.
+void SaveIndex::retain(std::vector<std::string> const &saves_) {
+   std::unordered_set<std::string> listed{saves_.begin(), saves_.end()};
+
+   for (auto entry{m_entries.begin()}; entry != m_entries.end();) {
+      if (listed.count(entry->first) == 0) {
+         entry = m_entries.erase(entry);
+         m_changed = true;
+      } else {
+         ++entry;
+      }
+   }
+}
+
+/// @brief Writes the index back to its file, if it changed.
+/// @return True if the file is up to date; otherwise, false.
+bool SaveIndex::store() {
+   if (!m_changed) {
+      return true;
+   }
+
+   // Write next to the index and rename, so it is never left half written.
+   std::string temporary{m_file + ".tmp"};
+
+   {
+      std::ofstream file{temporary, std::ios::out | std::ios::trunc};
+      file << SAVE_INDEX_HEADER << '\n';
+
+      for (auto const &entry : m_entries) {
+         file << entry.second.m_modified << ' ' << entry.second.m_size << ' '
+              << entry.second.m_bank_id << ' ' << entry.second.m_bank_version
+              << ' ' << entry.second.m_board_id << ' '
+              << (entry.second.m_valid ? 1 : 0) << ' ' << entry.first << '\n';
+      }
+
+      if (!file.flush()) {
+         std::remove(temporary.c_str());
+         return false;
+      }
+   }
+
+   if (std::rename(temporary.c_str(), m_file.c_str()) != 0) {
+      std::remove(temporary.c_str());
+      return false;
+   }
+
+   m_changed = false;
+   return true;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file SaveIndex.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares the index that remembers what each save file holds.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Listing the saves of a bank only needs the bank, the board and whether the
+ * actions are valid, but finding them out means reading every save. The index
+ * keeps them for each save file, together with the modification time and the
+ * size of the file when it was read: an entry is used only while both still
+ * match, so only the saves added or changed since are read again. Even those
+ * only have their first bytes read (see readSaveHeader()), on several threads
+ * when there are many: the actions are read and checked when a save is
+ * picked.
+ *
+ * The index is a text file: the line "SAVI 1", then one line per save with
+ * the time, the size, the bank id, the bank version, the board id, 1 if the
+ * file starts like a save (0 otherwise) and the path of the save, which takes
+ * the rest of the line.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SAVE_INDEX_HPP_
+#define SAVE_INDEX_HPP_
+
+#include "Save.hpp"
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// First line of an index.
+std::string const SAVE_INDEX_HEADER{"SAVI 1"};
+
+/// Saves below which the files are read on a single thread.
+constexpr size_t const SAVE_SCAN_PARALLEL_MIN{64};
+
+/**
+ * @struct SaveIndexEntry
+ * @brief What the index knows about a save file.
+ */
+struct SaveIndexEntry {
+   long long m_modified;      ///< Modification time of the file when read.
+   unsigned long long m_size; ///< Size of the file when read.
+   int m_bank_id;             ///< The ID of the bank of the save.
+   int m_bank_version;        ///< The version of the bank of the save.
+   int m_board_id;            ///< The ID of the board of the save.
+   bool m_valid;              ///< Whether the file starts like a save.
+};
+
+/**
+ * @class SaveIndex
+ * @brief Keeps the index of the save files of a folder.
+ */
+class SaveIndex {
+ private:
+   std::string m_file; ///< The file name of the index.
+   std::unordered_map<std::string, SaveIndexEntry>
+       m_entries;  ///< The entries, by path of the save.
+   bool m_changed; ///< Whether the entries differ from the file.
+
+   /**
+    * @brief Get the modification time and size of a save file.
+    * @param save_ The path of the save.
+    * @return A pair with true and an entry holding only the time and size if
+    * the file exists; otherwise, false.
+    */
+   static std::pair<bool, SaveIndexEntry> stamp(std::string const &save_);
+
+   /**
+    * @brief Reads the entry of a save from its file.
+    * @param save_ The path of the save.
+    * @return A pair with true and the entry if the file could be stamped;
+    * otherwise, false and the entry, to be read again next time.
+    */
+   static std::pair<bool, SaveIndexEntry> readEntry(std::string const &save_);
+
+ public:
+   /**
+    * @brief Default constructor; the index starts empty.
+    */
+   SaveIndex();
+
+   /**
+    * @brief Reads an index, replacing the entries.
+    * @param file_ The file name of the index.
+    * @return True if the file is an index; otherwise, false and the index
+    * starts empty (it is still written to file_ by store()).
+    */
+   bool load(std::string const &file_);
+
+   /**
+    * @brief Looks up a save whose file did not change since it was indexed.
+    * @param save_ The path of the save.
+    * @return A pair with true and the entry if it is up to date; otherwise,
+    * false.
+    */
+   std::pair<bool, SaveIndexEntry> find(std::string const &save_) const;
+
+   /**
+    * @brief Get the entries of saves, reading the files of those not up to
+    * date in the index and indexing them.
+    * @param saves_ The paths of the saves.
+    * @param threads_ Number of threads (0 uses one per hardware thread).
+    * @return The entries, in the order of saves_.
+    */
+   std::vector<SaveIndexEntry> scan(std::vector<std::string> const &saves_,
+                                    unsigned threads_ = 0);
+
+   /**
+    * @brief Drops the entries of the saves not listed.
+    * @param saves_ The paths of the saves that still exist.
+    */
+   void retain(std::vector<std::string> const &saves_);
+
+   /**
+    * @brief Writes the index back to its file, if it changed.
+    * @return True if the file is up to date; otherwise, false.
+    */
+   bool store();
+};
+
+#endif /// SAVE_INDEX_HPP_
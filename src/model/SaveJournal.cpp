@@ -0,0 +1,445 @@
+/**
+ * @file SaveJournal.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the append-only journal of saved games.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "SaveJournal.hpp"
+#include "Sudoku.hpp"
+#include "checksum/Crc32.hpp"
+#include "packing/Packing.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#define SAVE_JOURNAL_FSYNC
+#endif
+
+/// @brief Compares the moves of two actions, ignoring the value they replace.
+/// @param left_ The first action.
+/// @param right_ The second action.
+/// @return True if both make the same move; otherwise, false.
+static bool sameAction(ActionGame const &left_, ActionGame const &right_) {
+   return left_.m_x == right_.m_x && left_.m_y == right_.m_y &&
+          left_.m_value == right_.m_value && left_.m_action == right_.m_action;
+}
+
+/// @brief Packs the move of an action in ACTION_CODE_BITS bits.
+/// @param action_ The action.
+/// @return A pair with true and the code if the action is on the board;
+/// otherwise, false.
+std::pair<bool, std::uint32_t> packAction(ActionGame const &action_) {
+   if (action_.m_x <= 0 || action_.m_x > BOARD_SIZE || action_.m_y <= 0 ||
+       action_.m_y > BOARD_SIZE) {
+      return {false, 0};
+   }
+
+   // Removals clear the cell; insertions put a digit in it.
+   int value{0};
+
+   if (action_.m_action == Insert) {
+      if (action_.m_value <= 0 || action_.m_value > BOARD_SIZE) {
+         return {false, 0};
+      }
+
+      value = action_.m_value;
+   } else if (action_.m_action != Remove) {
+      return {false, 0};
+   }
+
+   int cell{(action_.m_y - 1) * BOARD_SIZE + (action_.m_x - 1)};
+   return {true, static_cast<std::uint32_t>(cell * (BOARD_SIZE + 1) + value)};
+}
+
+/// @brief Unpacks an action packed by packAction().
+/// @param code_ The code.
+/// @return A pair with true and the action if the code is valid; otherwise,
+/// false.
+std::pair<bool, ActionGame> unpackAction(std::uint32_t code_) {
+   ActionGame action{};
+
+   if (code_ >= BOARD_SIZE * BOARD_SIZE * (BOARD_SIZE + 1)) {
+      return {false, action};
+   }
+
+   int cell{static_cast<int>(code_) / (BOARD_SIZE + 1)};
+   int value{static_cast<int>(code_) % (BOARD_SIZE + 1)};
+
+   action.m_x = static_cast<short>(cell % BOARD_SIZE + 1);
+   action.m_y = static_cast<short>(cell / BOARD_SIZE + 1);
+   action.m_value = static_cast<short>(value);
+   action.m_action = value == 0 ? Remove : Insert;
+
+   return {true, action};
+}
+
+/// @brief Checks if a file starts with the journal magic.
+/// @param file_ The file name.
+/// @return True if the file is a journal; otherwise, false.
+bool isJournalFile(std::string const &file_) {
+   std::ifstream file{file_, std::ios::in | std::ios::binary};
+   char magic[sizeof(JOURNAL_MAGIC)]{0};
+
+   file.read(magic, sizeof(magic));
+
+   return static_cast<bool>(file) &&
+          std::memcmp(magic, JOURNAL_MAGIC, sizeof(magic)) == 0;
+}
+
+/// @brief Reads the game saved in the bytes of a journal.
+/// @param bytes_ The bytes of the journal.
+/// @param save_ Receives the saved game, up to the last valid record.
+/// @return True if the journal has a valid snapshot; otherwise, false.
+static bool readJournalBytes(std::vector<unsigned char> const &bytes_,
+                              Save &save_) {
+   unsigned char const *data{bytes_.data()};
+   size_t size{bytes_.size()};
+   size_t offset{sizeof(JOURNAL_MAGIC) + 1};
+
+   std::uint32_t fields[5];
+
+   for (std::uint32_t &field : fields) {
+      if (!ext::getVarint(data, size, offset, field)) {
+         return false;
+      }
+   }
+
+   // Check the size before trusting the count of actions.
+   size_t count{fields[4]};
+   size_t packed{ext::packedBytes(count, ACTION_CODE_BITS)};
+
+   if (size - offset < packed + sizeof(std::uint32_t) ||
+       ext::getFixed32(data + offset + packed) !=
+           ext::crc32(data, offset + packed)) {
+      return false;
+   }
+
+   save_.m_bank_id = ext::unzigzag(fields[0]);
+   save_.m_bank_version = ext::unzigzag(fields[1]);
+   save_.m_board_id = ext::unzigzag(fields[2]);
+   save_.m_checks = ext::unzigzag(fields[3]);
+   save_.m_actions.clear();
+   save_.m_actions.reserve(count);
+
+   ext::BitReader bits{data + offset, packed};
+
+   for (size_t index{0}; index != count; ++index) {
+      std::uint32_t code{0};
+      bits.get(ACTION_CODE_BITS, code);
+
+      std::pair<bool, ActionGame> action{unpackAction(code)};
+
+      if (action.first) {
+         save_.m_actions.push_back(action.second);
+      }
+   }
+
+   offset += packed + sizeof(std::uint32_t);
+
+   // Apply the records up to the first one that is not intact.
+   for (std::uint32_t sequence{1}; offset != size; ++sequence) {
+      size_t start{offset++};
+      std::uint32_t value{0};
+
+      if (!ext::getVarint(data, size, offset, value) ||
+          size - offset < sizeof(std::uint32_t) ||
+          ext::getFixed32(data + offset) !=
+              ext::crc32(data + start, offset - start, sequence)) {
+         break;
+      }
+
+      offset += sizeof(std::uint32_t);
+
+      if (data[start] == RecordAction) {
+         std::pair<bool, ActionGame> action{unpackAction(value)};
+
+         if (!action.first) {
+            break;
+         }
+
+         save_.m_actions.push_back(action.second);
+      } else if (data[start] == RecordTruncate &&
+                 value <= save_.m_actions.size()) {
+         save_.m_actions.resize(value);
+      } else if (data[start] == RecordChecks) {
+         save_.m_checks = ext::unzigzag(value);
+      } else {
+         break;
+      }
+   }
+
+   return true;
+}
+
+/// @brief Reads the game saved in a journal.
+/// @param file_ The file name of the journal.
+/// @param save_ Receives the saved game, up to the last valid record.
+/// @return True if the file has a valid journal header; otherwise, false.
+bool readJournal(std::string const &file_, Save &save_) {
+   std::ifstream file{file_, std::ios::in | std::ios::binary};
+   std::vector<unsigned char> bytes{std::istreambuf_iterator<char>{file},
+                                    std::istreambuf_iterator<char>{}};
+
+   if (bytes.size() <= sizeof(JOURNAL_MAGIC) ||
+       std::memcmp(bytes.data(), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) {
+      return false;
+   }
+
+   if (bytes[sizeof(JOURNAL_MAGIC)] != JOURNAL_VERSION) {
+      return false;
+   }
+
+   return readJournalBytes(bytes, save_);
+}
+
+/// @brief Reads the bank and board of the game saved in a journal, leaving out
+/// its actions and checks.
+/// @param bytes_ The first bytes of the journal.
+/// @param size_ The number of bytes, up to JOURNAL_HEADER_BYTES.
+/// @param save_ Receives the bank and board of the saved game.
+/// @return True if the bytes start like a journal; otherwise, false.
+bool readJournalHeader(unsigned char const *bytes_, size_t size_,
+                       Save &save_) {
+   if (size_ <= sizeof(JOURNAL_MAGIC) ||
+       std::memcmp(bytes_, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) {
+      return false;
+   }
+
+   save_.m_checks = 0;
+   save_.m_actions.clear();
+
+   if (bytes_[sizeof(JOURNAL_MAGIC)] != JOURNAL_VERSION) {
+      return false;
+   }
+
+   // The snapshot is checked as a whole when the game is read.
+   static_assert(sizeof(JOURNAL_MAGIC) + 1 + 3 * ext::VARINT_MAX_BYTES <=
+                     JOURNAL_HEADER_BYTES,
+                 "The fields of the snapshot fit in the header bytes");
+   size_t offset{sizeof(JOURNAL_MAGIC) + 1};
+   std::uint32_t fields[3];
+
+   for (std::uint32_t &field : fields) {
+      if (!ext::getVarint(bytes_, size_, offset, field)) {
+         return false;
+      }
+   }
+
+   save_.m_bank_id = ext::unzigzag(fields[0]);
+   save_.m_bank_version = ext::unzigzag(fields[1]);
+   save_.m_board_id = ext::unzigzag(fields[2]);
+   return true;
+}
+
+/// @brief Default constructor for the SaveJournal class.
+SaveJournal::SaveJournal()
+    : m_file{nullptr}, m_written{}, m_sequence{1}, m_records{0} {}
+
+/// @brief Destructor for the SaveJournal class.
+SaveJournal::~SaveJournal() { close(); }
+
+/// @brief Appends a record and its checksum.
+/// @param bytes_ The bytes to append to.
+/// @param type_ What the record does.
+/// @param value_ The packed action, the actions kept or the checks left
+/// (zigzagged).
+void SaveJournal::addRecord(std::vector<unsigned char> &bytes_,
+                            JournalRecordType type_, std::uint32_t value_) {
+   size_t start{bytes_.size()};
+
+   bytes_.push_back(static_cast<unsigned char>(type_));
+   ext::putVarint(bytes_, value_);
+   ext::putFixed32(bytes_, ext::crc32(bytes_.data() + start,
+                                      bytes_.size() - start, m_sequence++));
+}
+
+/// @brief Writes bytes at the end of the journal and flushes them to the disk.
+/// @param bytes_ The bytes.
+/// @return True if every byte was written; otherwise, false.
+bool SaveJournal::writeBytes(std::vector<unsigned char> const &bytes_) {
+   if (std::fwrite(bytes_.data(), 1, bytes_.size(), m_file) !=
+           bytes_.size() ||
+       std::fflush(m_file) != 0) {
+      return false;
+   }
+
+#if defined(SAVE_JOURNAL_FSYNC)
+   // Make sure the records survive a crash before reporting the save.
+   return fsync(fileno(m_file)) == 0;
+#else
+   return true;
+#endif
+}
+
+/// @brief Writes a compact journal of a game, replacing the file.
+/// @param file_ The file name of the journal.
+/// @param save_ The game to save.
+/// @return True if the journal was written; otherwise, false.
+bool SaveJournal::create(std::string const &file_, Save const &save_) {
+   // Copy the name first: it may be m_name itself.
+   std::string name{file_};
+   close();
+
+   std::string temporary{name + ".tmp"};
+   m_file = std::fopen(temporary.c_str(), "wb");
+
+   if (m_file == nullptr) {
+      return false;
+   }
+
+   // The snapshot: the magic, the version, the fields and the actions.
+   std::vector<unsigned char> bytes{std::begin(JOURNAL_MAGIC),
+                                    std::end(JOURNAL_MAGIC)};
+   bytes.reserve(sizeof(JOURNAL_MAGIC) + 1 + 5 * ext::VARINT_MAX_BYTES +
+                 ext::packedBytes(save_.m_actions.size(), ACTION_CODE_BITS) +
+                 sizeof(std::uint32_t));
+   bytes.push_back(static_cast<unsigned char>(JOURNAL_VERSION));
+   ext::putVarint(bytes, ext::zigzag(save_.m_bank_id));
+   ext::putVarint(bytes, ext::zigzag(save_.m_bank_version));
+   ext::putVarint(bytes, ext::zigzag(save_.m_board_id));
+   ext::putVarint(bytes, ext::zigzag(save_.m_checks));
+
+   // Actions off the board are left out: restoring the game skips them.
+   std::vector<std::uint32_t> codes;
+   codes.reserve(save_.m_actions.size());
+
+   for (ActionGame const &action : save_.m_actions) {
+      std::pair<bool, std::uint32_t> code{packAction(action)};
+
+      if (code.first) {
+         codes.push_back(code.second);
+      }
+   }
+
+   ext::putVarint(bytes, static_cast<std::uint32_t>(codes.size()));
+   ext::BitWriter bits{bytes};
+
+   for (std::uint32_t code : codes) {
+      bits.put(code, ACTION_CODE_BITS);
+   }
+
+   bits.flush();
+   ext::putFixed32(bytes, ext::crc32(bytes.data(), bytes.size()));
+   m_sequence = 1;
+
+   bool written{writeBytes(bytes)};
+   written = std::fclose(m_file) == 0 && written;
+   m_file = nullptr;
+
+   // Replace the previous file only once the new one is complete.
+   if (!written || std::rename(temporary.c_str(), name.c_str()) != 0) {
+      std::remove(temporary.c_str());
+      return false;
+   }
+
+   m_file = std::fopen(name.c_str(), "ab");
+
+   if (m_file == nullptr) {
+      return false;
+   }
+
+   m_name = name;
+   m_written = save_;
+   m_records = save_.m_actions.size() + 1;
+   return true;
+}
+
+/// @brief Appends the changes of a game since it was last written.
+/// @param save_ The game to save.
+/// @return True if the game was saved; otherwise, false.
+bool SaveJournal::append(Save const &save_) {
+   if (!isOpen()) {
+      return false;
+   }
+
+   // Another game goes to a new journal.
+   if (save_.m_bank_id != m_written.m_bank_id ||
+       save_.m_bank_version != m_written.m_bank_version ||
+       save_.m_board_id != m_written.m_board_id) {
+      return create(m_name, save_);
+   }
+
+   // Keep the actions both games start with.
+   size_t common{0};
+   size_t limit{std::min(save_.m_actions.size(), m_written.m_actions.size())};
+
+   while (common != limit &&
+          sameAction(save_.m_actions[common], m_written.m_actions[common])) {
+      ++common;
+   }
+
+   size_t count{(common != m_written.m_actions.size() ? 1u : 0u) +
+                (save_.m_actions.size() - common) +
+                (save_.m_checks != m_written.m_checks ? 1u : 0u)};
+
+   if (count == 0) {
+      return true; // Nothing changed.
+   }
+
+   // Rewrite the journal once it is mostly history.
+   if (m_records + count > JOURNAL_COMPACT_MIN &&
+       m_records + count > 2 * save_.m_actions.size()) {
+      return create(m_name, save_);
+   }
+
+   std::vector<unsigned char> bytes;
+   bytes.reserve(count * (2 + ext::VARINT_MAX_BYTES + sizeof(std::uint32_t)));
+
+   if (common != m_written.m_actions.size()) {
+      addRecord(bytes, RecordTruncate, static_cast<std::uint32_t>(common));
+   }
+
+   for (size_t index{common}; index != save_.m_actions.size(); ++index) {
+      std::pair<bool, std::uint32_t> code{packAction(save_.m_actions[index])};
+
+      if (code.first) {
+         addRecord(bytes, RecordAction, code.second);
+      }
+   }
+
+   if (save_.m_checks != m_written.m_checks) {
+      addRecord(bytes, RecordChecks, ext::zigzag(save_.m_checks));
+   }
+
+   if (!writeBytes(bytes)) {
+      // The state of the file is unknown: the next save must rewrite it.
+      close();
+      return false;
+   }
+
+   m_records += count;
+   m_written.m_actions.resize(common);
+   m_written.m_actions.insert(m_written.m_actions.end(),
+                              save_.m_actions.begin() + common,
+                              save_.m_actions.end());
+   m_written.m_checks = save_.m_checks;
+
+   return true;
+}
+
+/// @brief Closes the journal.
+void SaveJournal::close() {
+   if (m_file != nullptr) {
+      std::fclose(m_file);
+      m_file = nullptr;
+   }
+
+   m_written = Save{};
+   m_records = 0;
+   m_sequence = 1;
+}
+
+/// @brief Check if the journal is open.
+/// @return True if a journal is open; otherwise, false.
+bool SaveJournal::isOpen() const { return m_file != nullptr; }
+
+/// @brief Get the file name of the journal.
+/// @return The file name, empty if no journal was created.
+std::string const &SaveJournal::file() const { return m_name; }
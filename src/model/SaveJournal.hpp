@@ -0,0 +1,206 @@
+/**
+ * @file SaveJournal.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares the append-only journal layout of ".sav" files.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * A journal starts with a snapshot of the game: the magic "SAVJ", a byte with
+ * the layout version, then as varints (see Packing.hpp) the bank id and
+ * version, the board id, the checks left and the number of actions, then
+ * every action packed in ACTION_CODE_BITS bits, and the CRC-32 of all that.
+ * Records follow, each one a byte with its type, a varint and the CRC-32 of
+ * both seeded with the sequence number of the record (counting from 1). A
+ * record does one of:
+ *
+ * - RecordAction: appends the action packed in the varint;
+ * - RecordTruncate: keeps only the first actions, after an undo or when the
+ *   game took another branch;
+ * - RecordChecks: sets the number of checks left.
+ *
+ * Saving a game again only appends the records that turn the last saved
+ * state into the current one, so it costs a few bytes whatever the length of
+ * the game. Reading stops at the first record that is incomplete, damaged or
+ * out of sequence, which drops a write cut short by a crash. When the records
+ * outnumber twice the actions of the game, the file is compacted: rewritten
+ * as a single snapshot next to it and renamed over the journal.
+ *
+ * An action only keeps its cell, and its value for an insertion: the value
+ * a cell held before is found again when the game is restored.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SAVE_JOURNAL_HPP_
+#define SAVE_JOURNAL_HPP_
+
+#include "Save.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Magic bytes at the start of a journal.
+constexpr char const JOURNAL_MAGIC[4]{'S', 'A', 'V', 'J'};
+
+/// Version of the journal layout.
+constexpr int const JOURNAL_VERSION{1};
+
+/// Bits of a packed action: its cell times ten plus its value (0 to remove).
+constexpr unsigned const ACTION_CODE_BITS{10};
+
+/// Bytes at the start of a journal that hold its bank and board.
+constexpr size_t const JOURNAL_HEADER_BYTES{24};
+
+/// Records below which a journal is never compacted.
+constexpr size_t const JOURNAL_COMPACT_MIN{256};
+
+/**
+ * @enum JournalRecordType
+ * @brief What a journal record does to the saved game.
+ */
+enum JournalRecordType {
+   RecordAction = 1,   ///< Appends m_action.
+   RecordTruncate = 2, ///< Keeps the first m_value actions.
+   RecordChecks = 3,   ///< Sets the checks left to m_value.
+};
+
+/**
+ * @brief Packs the move of an action in ACTION_CODE_BITS bits.
+ * @param action_ The action.
+ * @return A pair with true and the code if the action is on the board;
+ * otherwise, false.
+ */
+std::pair<bool, std::uint32_t> packAction(ActionGame const &action_);
+
+/**
+ * @brief Unpacks an action packed by packAction().
+ * @param code_ The code.
+ * @return A pair with true and the action if the code is valid; otherwise,
+ * false.
+ */
+std::pair<bool, ActionGame> unpackAction(std::uint32_t code_);
+
+/**
+ * @brief Checks if a file starts with the journal magic.
+ * @param file_ The file name.
+ * @return True if the file is a journal; otherwise, false.
+ */
+bool isJournalFile(std::string const &file_);
+
+/**
+ * @brief Reads the game saved in a journal.
+ * @param file_ The file name of the journal.
+ * @param save_ Receives the saved game, up to the last valid record.
+ * @return True if the file has a valid journal header; otherwise, false.
+ */
+bool readJournal(std::string const &file_, Save &save_);
+
+/**
+ * @brief Reads the bank and board of the game saved in a journal, leaving out
+ * its actions and checks.
+ * @param bytes_ The first bytes of the journal.
+ * @param size_ The number of bytes, up to JOURNAL_HEADER_BYTES.
+ * @param save_ Receives the bank and board of the saved game.
+ * @return True if the bytes start like a journal; otherwise, false.
+ */
+bool readJournalHeader(unsigned char const *bytes_, size_t size_,
+                       Save &save_);
+
+/**
+ * @class SaveJournal
+ * @brief Keeps a journal open and appends the changes of a game to it.
+ */
+class SaveJournal {
+ private:
+   std::FILE *m_file;        ///< The journal, opened for appending.
+   std::string m_name;       ///< The file name of the journal.
+   Save m_written;           ///< The game as the journal holds it.
+   std::uint32_t m_sequence; ///< Sequence number of the next record.
+   size_t m_records; ///< Records in the journal, an action of the snapshot
+                     ///< counting as one.
+
+   /**
+    * @brief Appends a record and its checksum.
+    * @param bytes_ The bytes to append to.
+    * @param type_ What the record does.
+    * @param value_ The packed action, the actions kept or the checks left
+    * (zigzagged).
+    */
+   void addRecord(std::vector<unsigned char> &bytes_, JournalRecordType type_,
+                  std::uint32_t value_);
+
+   /**
+    * @brief Writes bytes at the end of the journal and flushes them to the
+    * disk.
+    * @param bytes_ The bytes.
+    * @return True if every byte was written; otherwise, false.
+    */
+   bool writeBytes(std::vector<unsigned char> const &bytes_);
+
+ public:
+   /**
+    * @brief Default constructor; the journal starts closed.
+    */
+   SaveJournal();
+
+   /**
+    * @brief Deleted copy constructor.
+    */
+   SaveJournal(SaveJournal const &other_) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator.
+    */
+   SaveJournal &operator=(SaveJournal const &other_) = delete;
+
+   /**
+    * @brief Destructor; closes the journal.
+    */
+   ~SaveJournal();
+
+   /**
+    * @brief Writes a compact journal of a game, replacing the file.
+    *
+    * The journal is written to a temporary file which is then renamed, so the
+    * previous file stays whole until the new one is complete.
+    *
+    * @param file_ The file name of the journal.
+    * @param save_ The game to save.
+    * @return True if the journal was written; otherwise, false.
+    */
+   bool create(std::string const &file_, Save const &save_);
+
+   /**
+    * @brief Appends the changes of a game since it was last written.
+    *
+    * The journal is rewritten instead when it holds another game or when
+    * compacting it is due.
+    *
+    * @param save_ The game to save.
+    * @return True if the game was saved; otherwise, false.
+    */
+   bool append(Save const &save_);
+
+   /**
+    * @brief Closes the journal.
+    */
+   void close();
+
+   /**
+    * @brief Check if the journal is open.
+    * @return True if a journal is open; otherwise, false.
+    */
+   bool isOpen() const;
+
+   /**
+    * @brief Get the file name of the journal.
+    * @return The file name, empty if no journal was created.
+    */
+   std::string const &file() const;
+};
+
+#endif /// SAVE_JOURNAL_HPP_
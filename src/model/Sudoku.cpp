@@ -9,36 +9,35 @@
  */
 
 #include "Sudoku.hpp"
+#include "BankFormat.hpp"
+#include "BankWriter.hpp"
 #include <algorithm>
+#include <charconv>
 #include <fstream>
 #include <iostream>
 #include <math.h>
 
+/// Number of boards read per call when loading a bank.
+constexpr size_t const BANK_CHUNK{4096};
+
 /// @brief Saves a bank of Sudoku boards to a binary file.
 /// @param bank_ The Bank object to be saved to the file.
 /// @param file_ The file name where the bank will be saved.
-void saveBankToFile(Bank const &bank_, std::string const &file_) {
-   std::ofstream file{file_, std::ios::out | std::ios::binary};
-
-   // Save the bank's identifier to the file.
-   int id{bank_.m_id};
-   file.write(reinterpret_cast<char *>(&id), sizeof(id));
+/// @param format_ The layout of the boards in the file.
+void saveBankToFile(Bank const &bank_, std::string const &file_,
+                    BankFormat format_) {
+   BankWriter writer;
 
-   // Save the bank's version number to the file.
-   int version{bank_.m_version};
-   file.write(reinterpret_cast<char *>(&version), sizeof(version));
-
-   // Save the number of boards in the bank to the file.
-   int quant_of_boards{static_cast<int>(bank_.m_boards.size())};
-   file.write(reinterpret_cast<char *>(&quant_of_boards),
-              sizeof(quant_of_boards));
+   if (!writer.open(file_, bank_.m_id, bank_.m_version, format_)) {
+      return;
+   }
 
    // Save each board in the bank to the file.
-   for (Board board : bank_.m_boards) {
-      file.write(reinterpret_cast<char *>(&board), sizeof(board));
+   for (Board const &board : bank_.m_boards) {
+      writer.append(board);
    }
 
-   file.close();
+   writer.close();
 }
 
 /// @brief Reads a bank of Sudoku boards from a binary file.
@@ -47,24 +46,52 @@ void saveBankToFile(Bank const &bank_, std::string const &file_) {
 Bank readBankFromFile(std::string const &file_) {
    std::ifstream file{file_, std::ios::in | std::ios::binary};
 
-   Bank bank;
-   int quant_of_boards{0};
+   Bank bank{0, 0, {}};
+   BankHeader header;
 
-   // Read the bank's identifier from the file.
-   file.read(reinterpret_cast<char *>(&bank.m_id), sizeof(bank.m_id));
+   // Read the largest header and find out the layout of the boards.
+   char bytes[PACKED_HEADER_SIZE]{0};
+   file.read(bytes, sizeof(bytes));
 
-   // Read the bank's version number from the file.
-   file.read(reinterpret_cast<char *>(&bank.m_version), sizeof(bank.m_version));
+   if (!parseBankHeader(bytes, static_cast<size_t>(file.gcount()), header)) {
+      return bank;
+   }
 
-   // Read the number of boards in the bank from the file.
-   file.read(reinterpret_cast<char *>(&quant_of_boards),
-             sizeof(quant_of_boards));
+   bank.m_id = header.m_id;
+   bank.m_version = header.m_version;
 
-   // Read each board in the bank from the file and add it to the Bank object.
-   for (int index{0}; index != quant_of_boards; ++index) {
-      Board board;
-      file.read(reinterpret_cast<char *>(&board), sizeof(board));
-      bank.m_boards.push_back(board);
+   file.clear();
+   file.seekg(header.m_size);
+
+   if (header.m_format == BankRaw) {
+      // Read the boards in chunks, keeping only those read completely.
+      for (size_t read{0}; file && read < static_cast<size_t>(header.m_count);
+           read += BANK_CHUNK) {
+         size_t chunk{std::min(BANK_CHUNK, header.m_count - read)};
+         size_t start{bank.m_boards.size()};
+
+         bank.m_boards.resize(start + chunk);
+         file.read(reinterpret_cast<char *>(bank.m_boards.data() + start),
+                   chunk * sizeof(Board));
+         bank.m_boards.resize(start + file.gcount() / sizeof(Board));
+      }
+   } else {
+      std::vector<PackedBoard> packed(
+          std::min(BANK_CHUNK, static_cast<size_t>(header.m_count)));
+
+      // Unpack the boards in chunks, keeping only those read completely.
+      for (size_t read{0}; file && read < static_cast<size_t>(header.m_count);
+           read += BANK_CHUNK) {
+         size_t chunk{std::min(BANK_CHUNK, header.m_count - read)};
+
+         file.read(reinterpret_cast<char *>(packed.data()),
+                   chunk * sizeof(PackedBoard));
+
+         size_t complete{file.gcount() / sizeof(PackedBoard)};
+         for (size_t index{0}; index != complete; ++index) {
+            bank.m_boards.push_back(unpackBoard(packed[index]));
+         }
+      }
    }
 
    file.close();
@@ -72,25 +99,134 @@ Bank readBankFromFile(std::string const &file_) {
    return bank;
 }
 
+/// @brief Finds the position of a board id in a bank file.
+/// @param file_ The bank file, with the read position anywhere.
+/// @param header_ The header of the bank.
+/// @param size_ The size of the file in bytes.
+/// @param id_ The id of the board.
+/// @return A pair indicating success (true/false) and the position.
+static std::pair<bool, size_t> findBoardPosition(std::ifstream &file_,
+                                                 BankHeader const &header_,
+                                                 size_t size_, int id_) {
+   size_t count{static_cast<size_t>(header_.m_count)};
+   BankIndex index;
+   char footer[sizeof(BankIndex)]{0};
+
+   file_.seekg(size_ - std::min(size_, sizeof(BankIndex)));
+   file_.read(footer, sizeof(footer));
+
+   if (file_ && parseBankIndex(footer, header_, size_, index)) {
+      if (index.m_table_offset == 0) {
+         // Consecutive ids: the position follows from the id.
+         long long position{static_cast<long long>(id_) - index.m_first_id};
+         return {position >= 0 && static_cast<size_t>(position) < count,
+                 static_cast<size_t>(position)};
+      }
+
+      // Binary search the table, reading one entry per step.
+      size_t low{0};
+      size_t high{count};
+
+      while (low < high) {
+         size_t middle{low + (high - low) / 2};
+         BankIndexEntry entry;
+
+         file_.seekg(index.m_table_offset + middle * sizeof(BankIndexEntry));
+         file_.read(reinterpret_cast<char *>(&entry), sizeof(entry));
+
+         if (!file_) {
+            return {false, 0};
+         } else if (entry.m_id == id_) {
+            return {true, static_cast<size_t>(entry.m_position)};
+         } else if (entry.m_id < id_) {
+            low = middle + 1;
+         } else {
+            high = middle;
+         }
+      }
+
+      return {false, 0};
+   }
+
+   // Without an index, scan the ids of the records.
+   file_.clear();
+
+   for (size_t position{0}; position != count; ++position) {
+      int id{0};
+
+      file_.seekg(header_.m_size + position * header_.m_record);
+      file_.read(reinterpret_cast<char *>(&id), sizeof(id));
+
+      if (!file_) {
+         break;
+      } else if (id == id_) {
+         return {true, position};
+      }
+   }
+
+   return {false, 0};
+}
+
+/// @brief Reads a single board of a bank file from its id.
+/// @param file_ The file name of the bank.
+/// @param id_ The id of the board.
+/// @return A pair indicating success (true/false) and the board read.
+std::pair<bool, Board> readBoardAt(std::string const &file_, int id_) {
+   std::ifstream file{file_, std::ios::in | std::ios::binary};
+   Board board;
+
+   char bytes[PACKED_HEADER_SIZE]{0};
+   file.read(bytes, sizeof(bytes));
+
+   BankHeader header;
+   if (!parseBankHeader(bytes, static_cast<size_t>(file.gcount()), header)) {
+      return {false, board};
+   }
+
+   file.clear();
+   file.seekg(0, std::ios::end);
+   size_t size{static_cast<size_t>(file.tellg())};
+
+   // A truncated file means a corrupt bank.
+   if (size < header.m_size || static_cast<size_t>(header.m_count) >
+                                   (size - header.m_size) / header.m_record) {
+      return {false, board};
+   }
+
+   std::pair<bool, size_t> position{
+       findBoardPosition(file, header, size, id_)};
+
+   if (!position.first) {
+      return {false, board};
+   }
+
+   file.clear();
+   file.seekg(header.m_size + position.second * header.m_record);
+
+   if (header.m_format == BankRaw) {
+      file.read(reinterpret_cast<char *>(&board), sizeof(board));
+   } else {
+      PackedBoard packed;
+      file.read(reinterpret_cast<char *>(&packed), sizeof(packed));
+      board = unpackBoard(packed);
+   }
+
+   return {static_cast<bool>(file) && board.m_id == id_, board};
+}
+
 /// @brief Constructor for the Sudoku class.
 /// @param original_board_ The original Sudoku board to initialize the game.
 /// @param checks_ The number of checks or moves allowed in the game.
 /// @param actions_ A vector of previous game actions.
 Sudoku::Sudoku(Board const &original_board_, int checks_,
-               std::vector<ActionGame> actions_) {
+               std::vector<ActionGame> const &actions_) {
    // Initialize the Sudoku board and game parameters.
    m_board = original_board_;
    m_current_board = replaceNegatives(original_board_);
    m_checks = checks_;
 
-   // Reserve memory for the actions and copy the provided actions.
-   m_actions.reserve(actions_.size());
-   std::copy(
-       actions_.begin(), actions_.end(),
-       m_actions.begin()); /// Executar as ações de entrada no current_board
-
-   // Execute save actions to update the current board based on previous
-   // actions.
+   // Execute save actions to update the current board and rebuild the move
+   // tree from previous actions; this also builds the occupancy.
    executeSaveActions(actions_);
 }
 
@@ -115,104 +251,183 @@ Board Sudoku::replaceNegatives(Board const &board_) {
    return temp_board; // Return the modified board.
 }
 
-/// @brief Executes a series of saved game actions to update the Sudoku board.
-/// @param actions_ A vector of previous game actions to apply to the board.
-void Sudoku::executeSaveActions(std::vector<ActionGame> actions_) {
-   for (auto action : actions_) {
-      switch (action.m_action) {
-      case Insert:
-         // If the action is to insert a value, call the insert method.
-         insert(action.m_value, action.m_x, action.m_y);
-         break;
-      case Remove:
-         // If the action is to remove a value, call the remove method.
-         remove(action.m_x, action.m_y);
-         break;
-      default:
-         // Handle any other actions (if needed).
-         break;
-      }
-   }
-}
-/// @brief Checks the current Sudoku board for correctness in linear regions
-/// (rows and columns).
-/// @return True if the linear regions are correct, otherwise false.
-bool Sudoku::checkCurrentLinear() const {
-   for (int row{0}; row != BOARD_SIZE; ++row) {
-      int values_row[BOARD_SIZE + 1]{0};
-      int values_column[BOARD_SIZE + 1]{0};
+/// @brief Rebuilds the row, column and block occupancy from the current board.
+void Sudoku::resetOccupancy() {
+   std::fill(std::begin(m_row_masks), std::end(m_row_masks), 0);
+   std::fill(std::begin(m_column_masks), std::end(m_column_masks), 0);
+   std::fill(std::begin(m_block_masks), std::end(m_block_masks), 0);
+   std::fill(&m_row_counts[0][0], &m_row_counts[0][0] + BOARD_SIZE * BOARD_SIZE,
+             0);
+   std::fill(&m_column_counts[0][0],
+             &m_column_counts[0][0] + BOARD_SIZE * BOARD_SIZE, 0);
+   std::fill(&m_block_counts[0][0],
+             &m_block_counts[0][0] + BOARD_SIZE * BOARD_SIZE, 0);
+
+   m_linear_conflicts = 0;
+   m_block_conflicts = 0;
+   m_filled_cells = 0;
+   m_digits_left.fill(BOARD_SIZE);
 
+   for (int row{0}; row != BOARD_SIZE; ++row) {
       for (int column{0}; column != BOARD_SIZE; ++column) {
-         int value_row{m_current_board.m_values[row][column]};
-         int value_column{m_current_board.m_values[column][row]};
+         int value{m_current_board.m_values[row][column]};
 
-         // Check if values are out of bounds.
-         if (value_row < 0 || value_row > BOARD_SIZE) {
-            return false;
-         } else if (value_column < 0 || value_column > BOARD_SIZE) {
-            return false;
-         } else {
-            ++values_row[value_row];
-            ++values_column[value_column];
+         if (value != 0) {
+            markValue(row, column, value);
          }
       }
+   }
+}
 
-      // Check for duplicate values in rows and columns.
-      for (int value{1}; value != BOARD_SIZE + 1; ++value) {
-         if (values_row[value] > 1 || values_column[value] > 1) {
-            return false;
-         }
-      }
+/// @brief Registers a digit in the occupancy of a cell's row, column and
+/// block.
+/// @param row_ The zero-based row of the cell.
+/// @param column_ The zero-based column of the cell.
+/// @param value_ The digit (1-9) to register.
+void Sudoku::markValue(int row_, int column_, int value_) {
+   // Values outside the digit range are not tracked.
+   if (value_ <= 0 || value_ > BOARD_SIZE) {
+      return;
+   }
+
+   int block{blockIndex(row_, column_)};
+   int digit{value_ - 1};
+   unsigned short mask{digitMask(value_)};
+
+   // A second occurrence of a digit in the same unit is a conflict.
+   if (++m_row_counts[row_][digit] == 2) {
+      ++m_linear_conflicts;
+   }
+   if (++m_column_counts[column_][digit] == 2) {
+      ++m_linear_conflicts;
+   }
+   if (++m_block_counts[block][digit] == 2) {
+      ++m_block_conflicts;
    }
 
-   return true; // Linear regions are correct.
+   m_row_masks[row_] |= mask;
+   m_column_masks[column_] |= mask;
+   m_block_masks[block] |= mask;
+
+   --m_digits_left[digit];
+   ++m_filled_cells;
 }
 
-/// @brief Checks the current Sudoku board for correctness in square blocks.
-/// @return True if the square blocks are correct, otherwise false.
-bool Sudoku::checkCurrentBlocks() const {
-   int sqrt{static_cast<int>(std::sqrt(BOARD_SIZE))};
-
-   for (int row{0}; row != sqrt; ++row) {
-      for (int column{0}; column != sqrt; ++column) {
-         int values[BOARD_SIZE + 1]{0};
-         int block_row{row * sqrt};
-         int block_column{column * sqrt};
-         int initial_block_column{block_column};
-
-         int last_row{block_row + sqrt};
-         int last_column{block_column + sqrt};
-
-         while (block_row != last_row) {
-            int value{m_current_board.m_values[block_row][block_column]};
-
-            // Check if values are out of bounds.
-            if (value < 0 || value > BOARD_SIZE) {
-               return false; // Value is out of bounds.
-            } else {
-               ++values[value]; // Count occurrences of each value in the block.
-            }
-
-            if (block_column + 1 == last_column) {
-               block_column = initial_block_column;
-               ++block_row;
-            } else {
-               ++block_column;
-            }
+/// @brief Unregisters a digit from the occupancy of a cell's row, column and
+/// block.
+/// @param row_ The zero-based row of the cell.
+/// @param column_ The zero-based column of the cell.
+/// @param value_ The digit (1-9) to unregister.
+void Sudoku::unmarkValue(int row_, int column_, int value_) {
+   // Values outside the digit range are not tracked.
+   if (value_ <= 0 || value_ > BOARD_SIZE) {
+      return;
+   }
+
+   int block{blockIndex(row_, column_)};
+   int digit{value_ - 1};
+   unsigned short mask{digitMask(value_)};
+
+   // Removing the second occurrence of a digit solves a conflict.
+   if (m_row_counts[row_][digit]-- == 2) {
+      --m_linear_conflicts;
+   }
+   if (m_column_counts[column_][digit]-- == 2) {
+      --m_linear_conflicts;
+   }
+   if (m_block_counts[block][digit]-- == 2) {
+      --m_block_conflicts;
+   }
+
+   // The digit bit is cleared only when its last occurrence leaves the unit.
+   if (m_row_counts[row_][digit] == 0) {
+      m_row_masks[row_] &= ~mask;
+   }
+   if (m_column_counts[column_][digit] == 0) {
+      m_column_masks[column_] &= ~mask;
+   }
+   if (m_block_counts[block][digit] == 0) {
+      m_block_masks[block] &= ~mask;
+   }
+
+   ++m_digits_left[digit];
+   --m_filled_cells;
+}
+
+/// @brief Changes the value of a cell of the current board, keeping the
+/// occupancy up to date.
+/// @param row_ The zero-based row of the cell.
+/// @param column_ The zero-based column of the cell.
+/// @param value_ The new value of the cell (0 empties it).
+void Sudoku::setCell(int row_, int column_, int value_) {
+   int &cell{m_current_board.m_values[row_][column_]};
+
+   if (cell == value_) {
+      return;
+   }
+
+   unmarkValue(row_, column_, cell);
+   cell = value_;
+   markValue(row_, column_, value_);
+}
+
+/// @brief Executes a series of saved game actions to update the Sudoku board.
+/// @param actions_ A vector of previous game actions to apply to the board.
+void Sudoku::executeSaveActions(std::vector<ActionGame> const &actions_) {
+   m_moves.reserve(actions_.size());
+
+   for (ActionGame const &saved : actions_) {
+      int x{saved.m_x};
+      int y{saved.m_y};
+
+      // Skip the actions that insert() or remove() would reject.
+      if (x <= 0 || x > BOARD_SIZE || y <= 0 || y > BOARD_SIZE ||
+          m_board.m_values[y - 1][x - 1] > 0) {
+         continue;
+      }
+
+      int &cell{m_current_board.m_values[y - 1][x - 1]};
+
+      ActionGame action;
+      action.m_x = saved.m_x;
+      action.m_y = saved.m_y;
+      action.m_previous = cell;
+      action.m_action = saved.m_action;
+
+      if (saved.m_action == Insert) {
+         if (saved.m_value <= 0 || saved.m_value > BOARD_SIZE ||
+             cell == saved.m_value) {
+            continue;
          }
 
-         // Check for duplicate values within the square block.
-         for (int value{1}; value != BOARD_SIZE + 1; ++value) {
-            if (values[value] > 1) {
-               return false; // Duplicate value found in the block.
-            }
+         action.m_value = saved.m_value;
+         cell = saved.m_value;
+      } else if (saved.m_action == Remove) {
+         if (m_board.m_values[y - 1][x - 1] == 0) {
+            continue;
          }
+
+         cell = 0;
+      } else {
+         continue;
       }
+
+      // Only the board changes here; the occupancy is rebuilt below.
+      m_moves.push(action);
    }
 
-   return true; // Square blocks are correct.
+   resetOccupancy();
 }
 
+/// @brief Checks the current Sudoku board for correctness in linear regions
+/// (rows and columns).
+/// @return True if the linear regions are correct, otherwise false.
+bool Sudoku::checkCurrentLinear() const { return m_linear_conflicts == 0; }
+
+/// @brief Checks the current Sudoku board for correctness in square blocks.
+/// @return True if the square blocks are correct, otherwise false.
+bool Sudoku::checkCurrentBlocks() const { return m_block_conflicts == 0; }
+
 /// @brief Checks the current Sudoku board for correctness by combining linear
 /// and block checks.
 /// @return True if the board is correct, otherwise false.
@@ -228,160 +443,154 @@ bool Sudoku::checkCurrent() const {
 /// @return True if the value is unique within its row, column, and square
 /// block, otherwise false.
 bool Sudoku::checkUniqueValue(int x_, int y_) const {
-   int value{m_current_board.m_values[y_ - 1][x_ - 1]};
-
-   // Check uniqueness in the same row.
-   for (int column{0}; column != BOARD_SIZE; ++column) {
-      int test_value{m_current_board.m_values[y_ - 1][column]};
-
-      if (test_value == value && column + 1 != x_) {
-         return false; // Value is not unique in the row.
-      }
-   }
-
-   // Check uniqueness in the same column.
-   for (int row{0}; row != BOARD_SIZE; ++row) {
-      int test_value{m_current_board.m_values[row][x_ - 1]};
-
-      if (test_value == value && row + 1 != y_) {
-         return false; // Value is not unique in the column.
-      }
-   }
-
-   int sqrt{static_cast<int>(std::sqrt(BOARD_SIZE))};
-   int initial_row{(y_ - 1) / sqrt * sqrt};
-   int initial_column{(x_ - 1) / sqrt * sqrt};
-
-   // Check uniqueness in the same square block.
-   for (int row{initial_row}; row != initial_row + sqrt; ++row) {
-      for (int column{initial_column}; column != initial_column + sqrt;
-           ++column) {
-         int test_value{m_current_board.m_values[row][column]};
+   int row{y_ - 1};
+   int column{x_ - 1};
+   int value{m_current_board.m_values[row][column]};
 
-         if (test_value == value && (row + 1 != y_ || column + 1 != x_)) {
-            return false; // Value is not unique in the square block.
-         }
-      }
+   // Empty cells cannot repeat a digit.
+   if (value <= 0 || value > BOARD_SIZE) {
+      return true;
    }
 
-   return true; // Value is unique in its row, column, and square block.
+   // The cell itself is the only occurrence of its digit in every unit.
+   int digit{value - 1};
+   return m_row_counts[row][digit] == 1 && m_column_counts[column][digit] == 1 &&
+          m_block_counts[blockIndex(row, column)][digit] == 1;
 }
 
-/// @brief Draws the Sudoku board with colored text.
+/// @brief Composes the Sudoku board with colored text into a frame.
+/// @param frame_ The frame to append to.
 /// @param correct_color_ The color for correct values.
 /// @param wrong_color_ The color for incorrect values.
 /// @param special_color_ The color for special values (optional).
-void Sudoku::drawWithColors(short correct_color_, short wrong_color_,
-                            short special_color_) const {
+void Sudoku::renderWithColors(BoardFrame &frame_, short correct_color_,
+                              short wrong_color_,
+                              short special_color_) const {
+   constexpr ext::Style const marker_style{ext::cfg::bright_yellow,
+                                           ext::cbg::none, ext::stl::bold};
+   constexpr ext::Style const label_style{ext::cfg::green};
+   constexpr ext::Style const original_style{ext::cfg::none, ext::cbg::none,
+                                             ext::stl::bold};
+
+   // The colors are composed once, not for every cell.
+   ext::Style const correct_style{correct_color_};
+   ext::Style const wrong_style{wrong_color_};
+   ext::Style const special_style{special_color_};
+
    // Define the top line of the board.
-   std::string board_table{"    +-------+-------+-------+"};
-   size_t max_size_in_line{board_table.size()};
+   std::string_view const board_table{"    +-------+-------+-------+\n"};
+   size_t const max_size_in_line{board_table.size() - 1};
    int width_empty{7};
    int sqrt_board{static_cast<int>(std::sqrt(BOARD_SIZE))};
 
    // Create and configure the first line to indicate the last action.
-   ext::fstring first_line{max_size_in_line, ' '};
-   if (!m_actions.empty()) {
-      int x{m_actions.back().m_x};
+   char line_buffer[64];
+   std::string_view const line{line_buffer, max_size_in_line};
+   std::fill_n(line_buffer, max_size_in_line, ' ');
+
+   if (!m_moves.empty()) {
+      int x{m_moves.last().m_x};
 
       int reference_location{width_empty +
                              2 * (((x - 1) / sqrt_board) + (x - 1)) - 1};
 
-      first_line[reference_location] = 'v';
-      first_line.color(ext::cfg::bright_yellow);
-      first_line.style(ext::stl::bold);
+      line_buffer[reference_location] = 'v';
+      frame_.appendStyled(line, marker_style);
+   } else {
+      frame_.append(line);
    }
 
-   std::cout << first_line << "\n";
+   frame_.append('\n');
 
    // Create and configure the second line with column numbers.
-   ext::fstring second_line{max_size_in_line, ' '};
+   std::fill_n(line_buffer, max_size_in_line, ' ');
    for (int reference{1}; reference != BOARD_SIZE + 1; ++reference) {
       int reference_location{
           width_empty + 2 * (((reference - 1) / sqrt_board) + (reference - 1)) -
           1};
-      second_line[reference_location] = reference + '0';
+      line_buffer[reference_location] = static_cast<char>(reference + '0');
    }
-   second_line.color(ext::cfg::green);
-   std::cout << second_line << "\n";
+   frame_.appendStyled(line, label_style);
+   frame_.append('\n');
 
-   std::cout << board_table << "\n";
+   frame_.append(board_table);
 
    // Loop through each row of the Sudoku board.
-   for (int line{0}; line != BOARD_SIZE; ++line) {
-      if (line != 0 && line % sqrt_board == 0) {
-         std::cout << "    |-------+-------+-------|\n";
+   for (int row{0}; row != BOARD_SIZE; ++row) {
+      if (row != 0 && row % sqrt_board == 0) {
+         frame_.append("    |-------+-------+-------|\n");
       }
 
-      // Check if there is a recent action on this row.
-      if (!m_actions.empty()) {
-         int row{m_actions.back().m_y};
-
-         // If the action was on this row, indicate it with a marker.
-         if (row == line + 1) {
-            ext::fstring reference{">"};
-            reference.color(ext::cfg::bright_yellow);
-            reference.style(ext::stl::bold);
-            std::cout << reference;
-         } else {
-            std::cout << " ";
-         }
+      // If the last action was on this row, indicate it with a marker.
+      if (!m_moves.empty() && m_moves.last().m_y == row + 1) {
+         frame_.appendStyled(">", marker_style);
       } else {
-         std::cout << " ";
+         frame_.append(' ');
       }
 
       // Display the row character (A, B, C, etc.).
-      ext::fstring character{" "};
-      character.push_back(line + 'A');
-      character.color(ext::cfg::green);
-      std::cout << character << " ";
+      char const character[2]{' ', static_cast<char>(row + 'A')};
+      frame_.appendStyled({character, sizeof(character)}, label_style);
+      frame_.append(' ');
 
       // Loop through each cell in the row.
       for (int number{0}; number != BOARD_SIZE; ++number) {
          if (number % sqrt_board == 0) {
-            std::cout << "| ";
+            frame_.append("| ");
          }
 
-         int current_value{m_current_board.m_values[line][number]};
-         int original_value{m_board.m_values[line][number]};
+         int current_value{m_current_board.m_values[row][number]};
+         int original_value{m_board.m_values[row][number]};
 
          // Check if the cell is empty.
          if (current_value == 0) {
-            std::cout << "  ";
+            frame_.append("  ");
+            continue;
          }
+
+         char digits[12];
+         char const *end{
+             std::to_chars(digits, digits + sizeof(digits), current_value).ptr};
+         std::string_view const value{digits,
+                                      static_cast<size_t>(end - digits)};
+
          // Check if the value is the same as the original board.
-         else if (current_value == original_value) {
-            ext::fstring original_str{std::to_string(current_value)};
-            original_str.style(ext::stl::bold);
-            std::cout << original_str << " ";
+         if (current_value == original_value) {
+            frame_.appendStyled(value, original_style);
          }
          // Check for a special value with unique color.
-         else if (!m_actions.empty() &&
-                  !checkUniqueValue(number + 1, line + 1) &&
+         else if (!m_moves.empty() && !checkUniqueValue(number + 1, row + 1) &&
                   special_color_ != ext::cfg::none) {
-            ext::fstring special_value{std::to_string(current_value)};
-            special_value.color(special_color_);
-            std::cout << special_value << " ";
+            frame_.appendStyled(value, special_style);
          }
          // Check for a correct value with the specified color.
          else if (current_value == -original_value) {
-            ext::fstring correct_value{std::to_string(current_value)};
-            correct_value.color(correct_color_);
-            std::cout << correct_value << " ";
+            frame_.appendStyled(value, correct_style);
          }
          // If none of the above conditions are met, consider it an incorrect
          // value.
          else {
-            ext::fstring incorrect_value{std::to_string(current_value)};
-            incorrect_value.color(wrong_color_);
-            std::cout << incorrect_value << " ";
+            frame_.appendStyled(value, wrong_style);
          }
+
+         frame_.append(' ');
       }
 
-      std::cout << "|\n";
+      frame_.append("|\n");
    }
 
-   std::cout << board_table << "\n";
+   frame_.append(board_table);
+}
+
+/// @brief Draws the Sudoku board with colored text, in a single write.
+/// @param correct_color_ The color for correct values.
+/// @param wrong_color_ The color for incorrect values.
+/// @param special_color_ The color for special values (optional).
+void Sudoku::drawWithColors(short correct_color_, short wrong_color_,
+                            short special_color_) const {
+   BoardFrame frame;
+   renderWithColors(frame, correct_color_, wrong_color_, special_color_);
+   frame.flush();
 }
 
 /// @brief Get the identifier of the current Sudoku board.
@@ -394,32 +603,33 @@ int Sudoku::getChecks() const { return m_checks; }
 
 /// @brief Get the list of actions performed on the Sudoku board.
 /// @return A vector containing the actions on the board.
-std::vector<ActionGame> Sudoku::getActions() const { return m_actions; }
+std::vector<ActionGame> Sudoku::getActions() const { return m_moves.path(); }
 
 /// @brief Get the count of actions performed on the Sudoku board.
 /// @return The count of actions in the history.
-size_t Sudoku::getActionsCount() const { return m_actions.size(); }
+size_t Sudoku::getActionsCount() const { return m_moves.depth(); }
 
 /// @brief Get the count of remaining digits for each number in the Sudoku
 /// board.
 /// @return An array representing the count of remaining digits for each number.
 std::array<int, BOARD_SIZE> Sudoku::getDigitsLeft() const {
-   std::array<int, BOARD_SIZE> digits;
-   digits.fill(BOARD_SIZE);
+   return m_digits_left;
+}
 
-   for (int y{0}; y != BOARD_SIZE; ++y) {
-      for (int x{0}; x != BOARD_SIZE; ++x) {
-         int value{m_current_board.m_values[y][x]};
+/// @brief Get the digits that can still be placed at a coordinate without
+/// repeating a value in its row, column or block.
+/// @param x_ The X coordinate (column) of the cell.
+/// @param y_ The Y coordinate (row) of the cell.
+/// @return A digit mask (bit 0 for digit 1) with the candidates of the cell.
+unsigned short Sudoku::getCandidates(int x_, int y_) const {
+   int row{y_ - 1};
+   int column{x_ - 1};
 
-         // If a value is found in the cell, decrement the corresponding digit
-         // count.
-         if (value != 0) {
-            --digits[value - 1];
-         }
-      }
-   }
+   unsigned short used{static_cast<unsigned short>(
+       m_row_masks[row] | m_column_masks[column] |
+       m_block_masks[blockIndex(row, column)])};
 
-   return digits;
+   return FULL_MASK & ~used;
 }
 
 /// @brief Inserts a value into the Sudoku board at a specified coordinate.
@@ -455,18 +665,19 @@ std::pair<bool, std::string> Sudoku::insert(int value_, int x_, int y_) {
       return {false, "This insertion has already been performed previously."};
    }
 
-   // Update the current board with the inserted value.
-   m_current_board.m_values[y_ - 1][x_ - 1] = value_;
-
-   // Create an action object for the insertion and add it to the actions
-   // history.
+   // Create an action object for the insertion, remembering the value it
+   // replaces, and add it to the actions history.
    ActionGame action;
    action.m_x = x_;
    action.m_y = y_;
    action.m_value = value_;
+   action.m_previous = m_current_board.m_values[y_ - 1][x_ - 1];
    action.m_action = Insert;
 
-   m_actions.push_back(action);
+   m_moves.push(action); // Undone moves stay as another branch.
+
+   // Update the current board with the inserted value.
+   setCell(y_ - 1, x_ - 1, value_);
 
    // Check if the move is valid but could be improved.
    if (!checkUniqueValue(x_, y_)) {
@@ -505,15 +716,18 @@ std::pair<bool, std::string> Sudoku::remove(int x_, int y_) {
       return {false, "The passed coordinate has no value."};
    }
 
-   // Remove the value from the current board.
-   m_current_board.m_values[y_ - 1][x_ - 1] = 0;
-
-   // Create an action object for the removal and add it to the actions history.
+   // Create an action object for the removal, remembering the value it
+   // removes, and add it to the actions history.
    ActionGame action;
    action.m_x = x_;
    action.m_y = y_;
+   action.m_previous = m_current_board.m_values[y_ - 1][x_ - 1];
    action.m_action = Remove;
-   m_actions.push_back(action);
+
+   m_moves.push(action); // Undone moves stay as another branch.
+
+   // Remove the value from the current board.
+   setCell(y_ - 1, x_ - 1, 0);
 
    // The removal is successful.
    return {true, ""};
@@ -524,25 +738,58 @@ std::pair<bool, std::string> Sudoku::remove(int x_, int y_) {
 /// message.
 
 std::pair<bool, std::string> Sudoku::undo() {
-   // Check if there are no moves to be undone.
-   if (m_actions.empty()) {
+   // Move back in the tree, checking if there are moves to be undone.
+   ActionGame action;
+   if (!m_moves.undo(action)) {
       return {false, "There are no moves to be undone."};
    }
 
-   // Copy the current actions and clear the action history.
-   auto actions{m_actions};
-   m_actions.clear();
+   // Put back the value the cell held before the action.
+   setCell(action.m_y - 1, action.m_x - 1, action.m_previous);
+
+   // The undo operation is successful.
+   return {true, ""};
+}
+
+/// @brief Redoes the last undone action (insertion or removal) in the Sudoku
+/// game.
+/// @return A pair indicating the success of the redo operation and an optional
+/// message.
+
+std::pair<bool, std::string> Sudoku::redo() {
+   // Move forward in the tree, checking if there are moves to be redone.
+   ActionGame action;
+   if (!m_moves.redo(action)) {
+      return {false, "There are no moves to be redone."};
+   }
+
+   // Apply the action again.
+   setCell(action.m_y - 1, action.m_x - 1,
+           action.m_action == Insert ? action.m_value : 0);
+
+   // The redo operation is successful.
+   return {true, ""};
+}
 
-   // Remove the last action from the copied list.
-   actions.pop_back();
+/// @brief Replaces the last action by the next one played from the same
+/// position in the Sudoku game.
+/// @return A pair indicating the success of the switch and an optional
+/// message.
 
-   // Reset the current board to its original state by replacing negatives.
-   m_current_board = replaceNegatives(m_board);
+std::pair<bool, std::string> Sudoku::switchBranch() {
+   // Move to the sibling in the tree, checking if there is one.
+   ActionGame undone;
+   ActionGame played;
+   if (!m_moves.switchBranch(undone, played)) {
+      return {false, "There are no other moves from this position."};
+   }
 
-   // Execute the saved actions to bring the current board up to date.
-   executeSaveActions(actions);
+   // Take back the current action and apply the other one.
+   setCell(undone.m_y - 1, undone.m_x - 1, undone.m_previous);
+   setCell(played.m_y - 1, played.m_x - 1,
+           played.m_action == Insert ? played.m_value : 0);
 
-   // The undo operation is successful.
+   // The switch is successful.
    return {true, ""};
 }
 
@@ -586,16 +833,7 @@ void Sudoku::drawOnlyWrong() const {
 /// @brief Checks if the Sudoku board is completely filled with valid values.
 /// @return True if the board is full, false otherwise.
 bool Sudoku::checkFull() const {
-   for (int row{0}; row != BOARD_SIZE; ++row) {
-      for (int column{0}; column != BOARD_SIZE; ++column) {
-         int value{m_current_board.m_values[row][column]};
-         if (value == 0) {
-            return false;
-         }
-      }
-   }
-
-   return true;
+   return m_filled_cells == BOARD_SIZE * BOARD_SIZE;
 }
 
 /// @brief Checks if the Sudoku board represents a winning state.
@@ -18,7 +18,8 @@
  boards.
  * - Functions for saving and reading banks to/from files.
  * - The `Sudoku` class, which encapsulates the Sudoku game logic, including
- methods for inserting, removing, undoing, and checking values, as well as
+ methods for inserting, removing, undoing, redoing, and checking values,
+ switching between branches of moves, as well as
  drawing the game grid.
  *
  * @copyright Copyright (c) 2023
@@ -29,14 +30,27 @@
 #define SUDOKU_HPP_
 
 #include "Actions.hpp"
+#include "Mask.hpp"
+#include "MoveTree.hpp"
+#include "format/FrameBuffer.hpp"
 #include "format/fstring.hpp"
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 /// Size of the Sudoku board.
 constexpr int const BOARD_SIZE{9};
 
+/// Number of cells of a Sudoku board.
+constexpr int const CELLS_COUNT{BOARD_SIZE * BOARD_SIZE};
+
+/// Bytes of the buffer a board is drawn into (a frame takes under 2 KiB).
+constexpr size_t const BOARD_FRAME_SIZE{4096};
+
+/// The buffer a board is drawn into.
+using BoardFrame = ext::FrameBuffer<BOARD_FRAME_SIZE>;
+
 /**
  * @struct Board
  * @brief Represents a Sudoku board.
@@ -57,20 +71,43 @@ struct Bank {
    std::vector<Board> m_boards; ///< Vector of Sudoku boards.
 };
 
+/**
+ * @enum BankFormat
+ * @brief Layouts of the boards in a ".sdk" file.
+ */
+enum BankFormat {
+   BankRaw = 1,    ///< Version 1: every board stored as a raw `Board`.
+   BankPacked = 2, ///< Version 2: magic header and 56-byte packed boards.
+};
+
 /**
  * @brief Saves a bank to a file.
  * @param bank_ The bank to be saved.
  * @param file_ The file name for saving the bank.
+ * @param format_ The layout of the boards in the file (packed by default).
  */
-void saveBankToFile(Bank const &bank_, std::string const &file_);
+void saveBankToFile(Bank const &bank_, std::string const &file_,
+                    BankFormat format_ = BankPacked);
 
 /**
- * @brief Reads a bank from a file.
+ * @brief Reads a bank from a file, in any of the bank formats.
  * @param file_ The file name from which to read the bank.
  * @return The bank read from the file.
  */
 Bank readBankFromFile(std::string const &file_);
 
+/**
+ * @brief Reads a single board of a bank file from its id.
+ *
+ * Uses the index footer of the file when there is one, so only the footer
+ * and the board itself are read; older files are scanned record by record.
+ *
+ * @param file_ The file name of the bank.
+ * @param id_ The id of the board.
+ * @return A pair indicating success (true/false) and the board read.
+ */
+std::pair<bool, Board> readBoardAt(std::string const &file_, int id_);
+
 /**
  * @class Sudoku
  * @brief Represents a Sudoku game.
@@ -80,7 +117,54 @@ class Sudoku {
    Board m_board;         ///< The original Sudoku board.
    Board m_current_board; ///< The current state of the Sudoku board.
    int m_checks;          ///< The number of checks made during the game.
-   std::vector<ActionGame> m_actions; ///< List of game actions.
+   MoveTree m_moves;      ///< Tree of game actions, with every branch.
+
+   unsigned short m_row_masks[BOARD_SIZE]{0};    ///< Digits used per row.
+   unsigned short m_column_masks[BOARD_SIZE]{0}; ///< Digits used per column.
+   unsigned short m_block_masks[BOARD_SIZE]{0};  ///< Digits used per block.
+   unsigned char m_row_counts[BOARD_SIZE][BOARD_SIZE]{
+       {0}}; ///< Occurrences of each digit per row.
+   unsigned char m_column_counts[BOARD_SIZE][BOARD_SIZE]{
+       {0}}; ///< Occurrences of each digit per column.
+   unsigned char m_block_counts[BOARD_SIZE][BOARD_SIZE]{
+       {0}};                  ///< Occurrences of each digit per block.
+   int m_linear_conflicts{0}; ///< Repeated digits in rows and columns.
+   int m_block_conflicts{0};  ///< Repeated digits in blocks.
+   int m_filled_cells{0};     ///< Number of non-empty cells.
+   std::array<int, BOARD_SIZE>
+       m_digits_left{}; ///< Remaining occurrences of each digit.
+
+   /**
+    * @brief Rebuilds the occupancy masks and counters from the current board.
+    */
+   void resetOccupancy();
+
+   /**
+    * @brief Registers a digit in the occupancy of a cell's row, column and
+    * block.
+    * @param row_ The zero-based row of the cell.
+    * @param column_ The zero-based column of the cell.
+    * @param value_ The digit (1-9) to register.
+    */
+   void markValue(int row_, int column_, int value_);
+
+   /**
+    * @brief Unregisters a digit from the occupancy of a cell's row, column and
+    * block.
+    * @param row_ The zero-based row of the cell.
+    * @param column_ The zero-based column of the cell.
+    * @param value_ The digit (1-9) to unregister.
+    */
+   void unmarkValue(int row_, int column_, int value_);
+
+   /**
+    * @brief Changes the value of a cell of the current board, keeping the
+    * occupancy up to date.
+    * @param row_ The zero-based row of the cell.
+    * @param column_ The zero-based column of the cell.
+    * @param value_ The new value of the cell (0 empties it).
+    */
+   void setCell(int row_, int column_, int value_);
 
    /**
     * @brief Replaces negative values in a board with zeros.
@@ -91,9 +175,14 @@ class Sudoku {
 
    /**
     * @brief Executes a list of save actions.
+    *
+    * The actions are applied to the board in a single pass, with the same
+    * checks as insert() and remove(); the occupancy is rebuilt once at the
+    * end instead of after every action.
+    *
     * @param actions_ The list of actions to execute.
     */
-   void executeSaveActions(std::vector<ActionGame> actions_);
+   void executeSaveActions(std::vector<ActionGame> const &actions_);
 
    /**
     * @brief Checks if the current board is valid in a linear fashion.
@@ -123,7 +212,18 @@ class Sudoku {
    bool checkUniqueValue(int x_, int y_) const;
 
    /**
-    * @brief Draws the Sudoku board with specified colors.
+    * @brief Composes the Sudoku board with specified colors into a frame.
+    * @param frame_ The frame to append to.
+    * @param correct_color_ Color for correctly placed values.
+    * @param wrong_color_ Color for incorrectly placed values.
+    * @param special_color_ Special color (optional) for specific elements.
+    */
+   void renderWithColors(BoardFrame &frame_, short correct_color_,
+                         short wrong_color_,
+                         short special_color_ = ext::cfg::none) const;
+
+   /**
+    * @brief Draws the Sudoku board with specified colors, in a single write.
     * @param correct_color_ Color for correctly placed values.
     * @param wrong_color_ Color for incorrectly placed values.
     * @param special_color_ Special color (optional) for specific elements.
@@ -144,7 +244,7 @@ class Sudoku {
     * @param actions_ List of game actions (default empty).
     */
    Sudoku(Board const &original_board_, int checks_,
-          std::vector<ActionGame> actions_ = {});
+          std::vector<ActionGame> const &actions_ = {});
 
    /**
     * @brief Get the identifier of the current board.
@@ -159,7 +259,7 @@ class Sudoku {
    int getChecks() const;
 
    /**
-    * @brief Get the list of game actions.
+    * @brief Get the list of game actions that led to the current board.
     * @return The list of game actions.
     */
    std::vector<ActionGame> getActions() const;
@@ -178,6 +278,15 @@ class Sudoku {
     */
    std::array<int, BOARD_SIZE> getDigitsLeft() const;
 
+   /**
+    * @brief Get the digits that can still be placed at a position without
+    * repeating a value in its row, column or block.
+    * @param x_ The x-coordinate of the position.
+    * @param y_ The y-coordinate of the position.
+    * @return A digit mask (bit 0 for digit 1) of the candidates.
+    */
+   unsigned short getCandidates(int x_, int y_) const;
+
    /**
     * @brief Insert a value at the specified position.
     * @param value_ The value to insert.
@@ -201,6 +310,19 @@ class Sudoku {
     */
    std::pair<bool, std::string> undo();
 
+   /**
+    * @brief Redo the last undone action.
+    * @return A pair indicating success (true/false) and an associated message.
+    */
+   std::pair<bool, std::string> redo();
+
+   /**
+    * @brief Replace the last action by another one played from the same
+    * position, cycling through the branches of the move tree.
+    * @return A pair indicating success (true/false) and an associated message.
+    */
+   std::pair<bool, std::string> switchBranch();
+
    /**
     * @brief Check the game for correctness.
     * @return A pair indicating success (true/false) and an associated message.
@@ -10,12 +10,41 @@
  * This program is used to test the conversion of a ".txt" file containing
  * Sudoku data to a ".sdk" bank using the functionalities provided by the
  * previous program. It reads a Sudoku bank from a ".sdk" file, displays bank
- * information, and prints each Sudoku board.
+ * information, and prints each Sudoku board. With "-c", it checks every board
+ * instead and lists the invalid ones with the reasons; adding "-q" only tells
+ * whether the bank is valid, stopping at the first invalid board.
  */
 
+#include "BankView.hpp"
 #include "Sudoku.hpp"
+#include "Validate.hpp"
 #include "cli/Cli.hpp"
 #include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Describes the faults of an invalid board.
+ *
+ * @param faults_ A bit set of BoardFault values.
+ * @return The names of the faults, separated by commas.
+ */
+std::string describeFaults(unsigned faults_) {
+   std::string description;
+
+   for (std::pair<BoardFault, char const *> fault :
+        {std::pair<BoardFault, char const *>{FaultRange, "range"},
+         {FaultRow, "row"},
+         {FaultColumn, "column"},
+         {FaultBlock, "block"}}) {
+      if (faults_ & fault.first) {
+         description += description.empty() ? "" : ", ";
+         description += fault.second;
+      }
+   }
+
+   return description;
+}
 
 /**
  * @brief The main function of the Sudoku data conversion test program.
@@ -31,28 +60,54 @@ int main(int argc, char *argv[]) {
    // Create a command-line argument parser
    ext::CLI cli;
    cli.addArgumentOutFile('d', "data", {".sdk"});
+   cli.addArgument('c', "check");
+   cli.addArgument('q', "quiet");
 
    // Parse command-line arguments
    cli.parse(argc, argv);
 
    // Retrieve the output file name
    std::string output_file{cli.receiveOutFile("-d")};
+   bool check{cli.receiveSimple("-c")};
+   bool quiet{cli.receiveSimple("-q")};
 
    // Check if a valid output file name is provided
    if (output_file == std::string()) {
       return 1;
    }
 
-   // Read the Sudoku bank from the specified ".sdk" file
-   Bank bank{readBankFromFile(output_file)};
+   // Map the Sudoku bank from the specified ".sdk" file
+   BankView bank;
+   bank.open(output_file);
 
    // Display bank information
-   std::cout << " >>> Bank id: " << bank.m_id << "\n";
-   std::cout << " >>> Bank version: " << bank.m_version << "\n";
-   std::cout << " >>> Boards: " << bank.m_boards.size() << "\n";
+   std::cout << " >>> Bank id: " << bank.id() << "\n";
+   std::cout << " >>> Bank version: " << bank.version() << "\n";
+   std::cout << " >>> Boards: " << bank.size() << "\n";
+
+   // Only answer whether the bank is valid
+   if (check && quiet) {
+      bool valid{validateBank(bank)};
+      std::cout << " >>> Valid bank: " << (valid ? "yes" : "no") << "\n";
+      return valid ? 0 : 1;
+   }
+
+   // Report the invalid boards instead of printing them
+   if (check) {
+      std::vector<BoardError> errors{reportBank(bank)};
+      std::cout << " >>> Invalid boards: " << errors.size() << "\n";
+
+      for (BoardError const &error : errors) {
+         std::cout << " >>> Board id " << error.m_id << " (position "
+                   << error.m_position << "): " << describeFaults(error.m_faults)
+                   << "\n";
+      }
+
+      return errors.empty() ? 0 : 1;
+   }
 
    // Iterate through each Sudoku board and print it
-   for (auto board : bank.m_boards) {
+   for (Board const &board : bank) {
       Sudoku game{board, 3};
       std::cout << "\n >>> Board id: " << game.getBoardId() << "\n";
       game.draw();
@@ -0,0 +1,128 @@
+/**
+ * @file solve.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Solve every board of a ".sdk" bank with a selectable engine.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @details
+ * This program reads a Sudoku bank, solves each board from its givens (the
+ * positive values) and compares the result with the solution stored in the
+ * bank. It reports how many boards were solved, how many have a unique
+ * solution and the throughput of the chosen engine.
+ *
+ * Usage: solve -d <bank.sdk> [-e bitmask|dlx]
+ */
+
+#include "BankView.hpp"
+#include "Solver.hpp"
+#include "Sudoku.hpp"
+#include "cli/Cli.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @brief Checks whether a solved board matches the solution of a bank board.
+ * @param board_ The bank board.
+ * @param solution_ The solved board.
+ * @return True if every cell holds the same digit; otherwise, false.
+ */
+bool sameSolution(Board const &board_, Board const &solution_);
+
+/**
+ * @brief The main function of the Sudoku bank solver.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv An array of command-line arguments.
+ * @return An integer representing the exit status of the program.
+ */
+int main(int argc, char *argv[]) {
+   // Create a command-line argument parser
+   ext::CLI cli;
+   cli.addArgumentInFile('d', "data", {".sdk"});
+   cli.addArgumentText('e', "engine", ENGINE_BITMASK);
+
+   // Parse command-line arguments
+   cli.parse(argc, argv);
+
+   std::string input_file{cli.receiveInFile("-d")};
+   std::string engine{cli.receiveText("-e")};
+
+   // Check if a valid input file is provided
+   if (input_file == std::string()) {
+      return 1;
+   }
+
+   std::unique_ptr<Solver> solver{makeSolver(engine)};
+
+   if (solver == nullptr) {
+      std::cout << " >>> Unknown engine: " << engine << "\n";
+      return 1;
+   }
+
+   BankView bank;
+
+   if (!bank.open(input_file)) {
+      std::cout << " >>> The bank is corrupt: " << input_file << "\n";
+      return 1;
+   }
+
+   std::cout << " >>> Bank id: " << bank.id() << "\n";
+   std::cout << " >>> Engine: " << engine << "\n";
+
+   size_t solved{0};
+   size_t unique{0};
+   size_t matching{0};
+
+   auto start{std::chrono::steady_clock::now()};
+
+   for (Board const &board : bank) {
+      // One search, stopped at a second solution, keeps the first one.
+      Board solution{board};
+      int solutions{solver->countSolutions(board, 2, &solution)};
+
+      if (solutions == 0) {
+         std::cout << " >>> Board " << board.m_id << " has no solution.\n";
+         continue;
+      }
+
+      ++solved;
+
+      if (solutions == 1) {
+         ++unique;
+      }
+
+      if (sameSolution(board, solution)) {
+         ++matching;
+      }
+   }
+
+   std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() -
+                                         start};
+
+   std::cout << " >>> Boards: " << bank.size() << "\n";
+   std::cout << " >>> Solved: " << solved << "\n";
+   std::cout << " >>> Unique: " << unique << "\n";
+   std::cout << " >>> Matching the bank: " << matching << "\n";
+   std::cout << " >>> Elapsed: " << elapsed.count() << " s ("
+             << (elapsed.count() > 0 ? bank.size() / elapsed.count()
+                                     : 0)
+             << " boards/s)\n";
+
+   return solved == bank.size() ? 0 : 1;
+}
+
+/// @brief Checks whether a solved board matches the solution of a bank board.
+bool sameSolution(Board const &board_, Board const &solution_) {
+   for (int row{0}; row != BOARD_SIZE; ++row) {
+      for (int column{0}; column != BOARD_SIZE; ++column) {
+         if (std::abs(board_.m_values[row][column]) !=
+             std::abs(solution_.m_values[row][column])) {
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
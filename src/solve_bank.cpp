@@ -0,0 +1,140 @@
+/**
+ * @file solve_bank.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Solve a whole ".sdk" bank in parallel and save the solved bank.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @details
+ * The boards of the bank are independent, so they are spread over a
+ * work-stealing thread pool. Every worker owns its own solving engine and
+ * writes each solution back to the slot of its board, which keeps the
+ * original order of the bank. At the end the program reports the throughput
+ * of each worker and saves the solved bank.
+ *
+ * Usage: solve-bank -d <bank.sdk> [-o <output.sdk>] [-e bitmask|dlx]
+ *                   [-t <threads>]
+ */
+
+#include "Solver.hpp"
+#include "Sudoku.hpp"
+#include "cli/Cli.hpp"
+#include "parallel/WorkStealingPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief The default filename of the solved bank.
+ */
+std::string const FILENAME{"solved.sdk"};
+
+/**
+ * @struct WorkerStats
+ * @brief Throughput counters of one worker, padded to a cache line.
+ */
+struct alignas(64) WorkerStats {
+   size_t m_boards{0};  ///< Boards solved by the worker.
+   double m_seconds{0}; ///< Time spent solving, in seconds.
+};
+
+/**
+ * @brief The main function of the parallel bank solver.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv An array of command-line arguments.
+ * @return An integer representing the exit status of the program.
+ */
+int main(int argc, char *argv[]) {
+   // Create a command-line argument parser
+   ext::CLI cli;
+   cli.addArgumentInFile('d', "data", {".sdk"});
+   cli.addArgumentOutFile('o', "output", {".sdk"}, FILENAME);
+   cli.addArgumentText('e', "engine", ENGINE_BITMASK);
+   cli.addArgumentInteger('t', "threads");
+
+   // Parse command-line arguments
+   cli.parse(argc, argv);
+
+   std::string input_file{cli.receiveInFile("-d")};
+   std::string output_file{cli.receiveOutFile("-o")};
+   std::string engine{cli.receiveText("-e")};
+   int threads{cli.receiveInteger("-t")};
+
+   // Check if a valid input file is provided
+   if (input_file == std::string()) {
+      return 1;
+   }
+
+   ext::WorkStealingPool pool{threads > 0 ? static_cast<unsigned>(threads)
+                                          : 0u};
+
+   // Each worker owns an engine, since engines keep internal buffers.
+   std::vector<std::unique_ptr<Solver>> solvers;
+   for (unsigned worker{0}; worker != pool.size(); ++worker) {
+      solvers.push_back(makeSolver(engine));
+
+      if (solvers.back() == nullptr) {
+         std::cout << " >>> Unknown engine: " << engine << "\n";
+         return 1;
+      }
+   }
+
+   Bank bank{readBankFromFile(input_file)};
+
+   std::cout << " >>> Bank id: " << bank.m_id << "\n";
+   std::cout << " >>> Engine: " << engine << "\n";
+   std::cout << " >>> Threads: " << pool.size() << "\n";
+
+   std::vector<WorkerStats> stats(pool.size());
+   std::atomic<size_t> unsolved{0};
+
+   auto start{std::chrono::steady_clock::now()};
+
+   pool.run(bank.m_boards.size(), [&](size_t index_, unsigned worker_) {
+      auto board_start{std::chrono::steady_clock::now()};
+
+      std::pair<bool, Board> result{solvers[worker_]->solve(
+          bank.m_boards[index_])};
+
+      if (result.first) {
+         // Write the solution back in place to keep the bank order.
+         bank.m_boards[index_] = result.second;
+      } else {
+         unsolved.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() -
+                                            board_start};
+      ++stats[worker_].m_boards;
+      stats[worker_].m_seconds += elapsed.count();
+   });
+
+   std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() -
+                                         start};
+
+   // Report the throughput of each worker and of the whole run.
+   for (unsigned worker{0}; worker != pool.size(); ++worker) {
+      WorkerStats const &worker_stats{stats[worker]};
+      double rate{worker_stats.m_seconds > 0
+                      ? worker_stats.m_boards / worker_stats.m_seconds
+                      : 0};
+
+      std::cout << " >>> Thread " << worker << ": " << worker_stats.m_boards
+                << " boards, " << rate << " boards/s\n";
+   }
+
+   std::cout << " >>> Boards: " << bank.m_boards.size() << "\n";
+   std::cout << " >>> Unsolved: " << unsolved.load() << "\n";
+   std::cout << " >>> Elapsed: " << elapsed.count() << " s ("
+             << (elapsed.count() > 0 ? bank.m_boards.size() / elapsed.count()
+                                     : 0)
+             << " boards/s)\n";
+
+   // Save the solved bank
+   saveBankToFile(bank, output_file);
+   std::cout << " >>> Saved to " << output_file << "\n";
+
+   return unsolved.load() == 0 ? 0 : 1;
+}
@@ -0,0 +1,265 @@
+/**
+ * @file BitmaskSolver.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the bitmask Sudoku solver.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "BitmaskSolver.hpp"
+#include <array>
+
+/// Number of units (rows, columns and blocks) of a Sudoku board.
+constexpr int const UNITS_COUNT{3 * BOARD_SIZE};
+
+/// @brief Builds the cell indices of every row, column and block.
+/// @return A table with the nine cells of each unit.
+constexpr std::array<std::array<unsigned char, BOARD_SIZE>, UNITS_COUNT>
+buildUnits() {
+   std::array<std::array<unsigned char, BOARD_SIZE>, UNITS_COUNT> units{};
+
+   for (int unit{0}; unit != BOARD_SIZE; ++unit) {
+      for (int index{0}; index != BOARD_SIZE; ++index) {
+         int block_row{(unit / BLOCK_SIZE) * BLOCK_SIZE + index / BLOCK_SIZE};
+         int block_column{(unit % BLOCK_SIZE) * BLOCK_SIZE + index % BLOCK_SIZE};
+
+         units[unit][index] = unit * BOARD_SIZE + index;
+         units[BOARD_SIZE + unit][index] = index * BOARD_SIZE + unit;
+         units[2 * BOARD_SIZE + unit][index] =
+             block_row * BOARD_SIZE + block_column;
+      }
+   }
+
+   return units;
+}
+
+/// Cells of every row, column and block.
+constexpr std::array<std::array<unsigned char, BOARD_SIZE>, UNITS_COUNT> const
+    UNITS{buildUnits()};
+
+/// @brief Loads the givens of a board into a search state.
+/// @param board_ The board to load; positive values are givens.
+/// @param state_ The state to initialize.
+/// @return False if two givens conflict; otherwise, true.
+bool BitmaskSolver::load(Board const &board_, State &state_) {
+   state_ = State{};
+   state_.m_empty = CELLS_COUNT;
+
+   for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+      int value{board_.m_values[cell / BOARD_SIZE][cell % BOARD_SIZE]};
+
+      // Only positive values are givens; the rest is left to the search.
+      if (value <= 0) {
+         continue;
+      }
+
+      if (value > BOARD_SIZE || !(candidates(state_, cell) & digitMask(value))) {
+         return false;
+      }
+
+      place(state_, cell, value);
+   }
+
+   return true;
+}
+
+/// @brief Get the candidates of an empty cell.
+/// @param state_ The search state.
+/// @param cell_ The cell index (0-80).
+/// @return The digit mask of the candidates.
+unsigned short BitmaskSolver::candidates(State const &state_, int cell_) {
+   int row{cell_ / BOARD_SIZE};
+   int column{cell_ % BOARD_SIZE};
+
+   return FULL_MASK & ~(state_.m_rows[row] | state_.m_columns[column] |
+                        state_.m_blocks[blockIndex(row, column)]);
+}
+
+/// @brief Places a digit in a cell.
+/// @param state_ The search state.
+/// @param cell_ The cell index (0-80).
+/// @param value_ The digit (1-9).
+void BitmaskSolver::place(State &state_, int cell_, int value_) {
+   int row{cell_ / BOARD_SIZE};
+   int column{cell_ % BOARD_SIZE};
+   unsigned short mask{digitMask(value_)};
+
+   state_.m_cells[cell_] = static_cast<unsigned char>(value_);
+   state_.m_rows[row] |= mask;
+   state_.m_columns[column] |= mask;
+   state_.m_blocks[blockIndex(row, column)] |= mask;
+   --state_.m_empty;
+}
+
+/// @brief Applies naked and hidden singles until nothing changes.
+/// @param state_ The search state.
+/// @return False if a contradiction was found; otherwise, true.
+bool BitmaskSolver::propagate(State &state_) {
+   bool changed{true};
+
+   while (changed && state_.m_empty != 0) {
+      changed = false;
+
+      // Naked singles: cells with a single candidate.
+      for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+         if (state_.m_cells[cell] != 0) {
+            continue;
+         }
+
+         unsigned short mask{candidates(state_, cell)};
+
+         if (mask == 0) {
+            return false; // No digit fits this cell.
+         } else if ((mask & (mask - 1)) == 0) {
+            place(state_, cell, lowestDigit(mask));
+            changed = true;
+         }
+      }
+
+      // Hidden singles: digits with a single place left in a unit.
+      for (auto const &unit : UNITS) {
+         unsigned short once{0};
+         unsigned short twice{0};
+         unsigned short used{0};
+
+         for (unsigned char cell : unit) {
+            if (state_.m_cells[cell] != 0) {
+               used |= digitMask(state_.m_cells[cell]);
+            } else {
+               unsigned short mask{candidates(state_, cell)};
+               twice |= once & mask;
+               once |= mask;
+            }
+         }
+
+         unsigned short missing{static_cast<unsigned short>(FULL_MASK & ~used)};
+
+         // A missing digit with no place at all makes the unit unsolvable.
+         if ((once & missing) != missing) {
+            return false;
+         }
+
+         unsigned short singles{
+             static_cast<unsigned short>(once & ~twice & missing)};
+
+         while (singles != 0) {
+            int value{lowestDigit(singles)};
+            singles &= singles - 1;
+
+            bool placed{false};
+
+            for (unsigned char cell : unit) {
+               if (state_.m_cells[cell] == 0 &&
+                   (candidates(state_, cell) & digitMask(value))) {
+                  place(state_, cell, value);
+                  placed = true;
+                  break;
+               }
+            }
+
+            // Another single of this unit already took the only cell left for
+            // this digit.
+            if (!placed) {
+               return false;
+            }
+
+            changed = true;
+         }
+      }
+   }
+
+   return true;
+}
+
+/// @brief Searches the solutions of a state, stopping at the limit.
+/// @param state_ The search state.
+void BitmaskSolver::search(State &state_) {
+   if (!propagate(state_)) {
+      return;
+   }
+
+   if (state_.m_empty == 0) {
+      if (++m_solutions == 1) {
+         m_solution = state_;
+      }
+      return;
+   }
+
+   // Branch on the empty cell with the fewest candidates.
+   int best_cell{-1};
+   int best_count{BOARD_SIZE + 1};
+   unsigned short best_mask{0};
+
+   for (int cell{0}; cell != CELLS_COUNT && best_count > 2; ++cell) {
+      if (state_.m_cells[cell] != 0) {
+         continue;
+      }
+
+      unsigned short mask{candidates(state_, cell)};
+      int count{countDigits(mask)};
+
+      if (count < best_count) {
+         best_cell = cell;
+         best_count = count;
+         best_mask = mask;
+      }
+   }
+
+   while (best_mask != 0) {
+      int value{lowestDigit(best_mask)};
+      best_mask &= best_mask - 1;
+
+      State next{state_};
+      place(next, best_cell, value);
+      search(next);
+
+      if (m_solutions >= m_limit) {
+         return;
+      }
+   }
+}
+
+/// @brief Runs a search from a board.
+/// @param board_ The board to solve.
+/// @param limit_ Number of solutions that stops the search.
+void BitmaskSolver::run(Board const &board_, int limit_) {
+   m_solutions = 0;
+   m_limit = limit_ > 0 ? limit_ : 1;
+
+   State state;
+   if (load(board_, state)) {
+      search(state);
+   }
+}
+
+/// @brief Solves a board.
+/// @param board_ The board to solve; positive values are givens.
+/// @return A pair indicating success (true/false) and the solved board, where
+/// givens stay positive and solved cells hold the negated digit.
+std::pair<bool, Board> BitmaskSolver::solve(Board const &board_) {
+   run(board_, 1);
+
+   if (m_solutions == 0) {
+      return {false, board_};
+   }
+
+   return {true, buildSolution(board_, m_solution.m_cells)};
+}
+
+/// @brief Counts the solutions of a board.
+/// @param board_ The board to inspect; positive values are givens.
+/// @param limit_ Number of solutions that stops the count.
+/// @param solution_ If not null, receives the first solution found.
+/// @return The number of solutions, capped at the limit.
+int BitmaskSolver::countSolutions(Board const &board_, int limit_,
+                                  Board *solution_) {
+   run(board_, limit_);
+
+   if (solution_ != nullptr && m_solutions != 0) {
+      *solution_ = buildSolution(board_, m_solution.m_cells);
+   }
+
+   return m_solutions;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file BitmaskSolver.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares a Sudoku solver based on digit bitmasks.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The solver keeps one 9-bit mask of used digits per row, column and block.
+ * Every search node first applies constraint propagation (naked singles and
+ * hidden singles) and then branches on the empty cell with the fewest
+ * candidates (minimum remaining values). Search states are small fixed-size
+ * structures copied on the stack, so solving does not allocate.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BITMASK_SOLVER_HPP_
+#define BITMASK_SOLVER_HPP_
+
+#include "Solver.hpp"
+
+/**
+ * @class BitmaskSolver
+ * @brief Solves Sudoku boards with bitmask propagation and MRV backtracking.
+ *
+ * Fast on boards that propagation mostly solves, which covers the usual
+ * human-oriented puzzles.
+ */
+class BitmaskSolver : public Solver {
+ private:
+   /**
+    * @struct State
+    * @brief A search node: the grid and the digits used by each unit.
+    */
+   struct State {
+      unsigned char m_cells[CELLS_COUNT];   ///< Digit per cell (0 = empty).
+      unsigned short m_rows[BOARD_SIZE];    ///< Digits used per row.
+      unsigned short m_columns[BOARD_SIZE]; ///< Digits used per column.
+      unsigned short m_blocks[BOARD_SIZE];  ///< Digits used per block.
+      int m_empty;                          ///< Number of empty cells.
+   };
+
+   State m_solution; ///< The first solution found by the last search.
+   int m_solutions;  ///< Number of solutions found by the last search.
+   int m_limit;      ///< Number of solutions that stops the search.
+
+   /**
+    * @brief Loads the givens of a board into a search state.
+    * @param board_ The board to load.
+    * @param state_ The state to initialize.
+    * @return False if two givens conflict; otherwise, true.
+    */
+   static bool load(Board const &board_, State &state_);
+
+   /**
+    * @brief Get the candidates of an empty cell.
+    * @param state_ The search state.
+    * @param cell_ The cell index (0-80).
+    * @return The digit mask of the candidates.
+    */
+   static unsigned short candidates(State const &state_, int cell_);
+
+   /**
+    * @brief Places a digit in a cell.
+    * @param state_ The search state.
+    * @param cell_ The cell index (0-80).
+    * @param value_ The digit (1-9).
+    */
+   static void place(State &state_, int cell_, int value_);
+
+   /**
+    * @brief Applies naked and hidden singles until nothing changes.
+    * @param state_ The search state.
+    * @return False if a contradiction was found; otherwise, true.
+    */
+   static bool propagate(State &state_);
+
+   /**
+    * @brief Searches the solutions of a state, stopping at the limit.
+    * @param state_ The search state.
+    */
+   void search(State &state_);
+
+   /**
+    * @brief Runs a search from a board.
+    * @param board_ The board to solve.
+    * @param limit_ Number of solutions that stops the search.
+    */
+   void run(Board const &board_, int limit_);
+
+ public:
+   /**
+    * @brief Default constructor for the BitmaskSolver class.
+    */
+   BitmaskSolver() : m_solutions{0}, m_limit{1} {}
+
+   /**
+    * @brief Solves a board.
+    * @param board_ The board to solve; positive values are givens.
+    * @return A pair indicating success (true/false) and the solved board.
+    */
+   std::pair<bool, Board> solve(Board const &board_) override;
+
+   /**
+    * @brief Counts the solutions of a board.
+    * @param board_ The board to inspect; positive values are givens.
+    * @param limit_ Number of solutions that stops the count (default 2, enough
+    * to tell unique boards apart).
+    * @param solution_ If not null, receives the first solution found, in the
+    * encoding of solve(); left untouched when there is none.
+    * @return The number of solutions, capped at the limit.
+    */
+   int countSolutions(Board const &board_, int limit_ = 2,
+                      Board *solution_ = nullptr) override;
+};
+
+#endif /// BITMASK_SOLVER_HPP_
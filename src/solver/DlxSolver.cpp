@@ -0,0 +1,260 @@
+/**
+ * @file DlxSolver.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the Dancing Links Sudoku solver.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "DlxSolver.hpp"
+
+/// Number of candidate rows (one per cell and digit).
+constexpr int const CANDIDATES_COUNT{CELLS_COUNT * BOARD_SIZE};
+
+/// Number of constraint columns (cell, row, column and block constraints).
+constexpr int const CONSTRAINTS_COUNT{4 * CELLS_COUNT};
+
+/// Number of constraints satisfied by each candidate.
+constexpr int const NODES_PER_ROW{4};
+
+/// Index of the root header; column headers follow it.
+constexpr int const ROOT{0};
+
+/// Total number of nodes: root, column headers and candidate nodes.
+constexpr int const NODES_COUNT{1 + CONSTRAINTS_COUNT +
+                                CANDIDATES_COUNT * NODES_PER_ROW};
+
+/// @brief Constructor for the DlxSolver class.
+/// Builds the whole exact cover matrix once; solves only relink it.
+DlxSolver::DlxSolver()
+    : m_left(NODES_COUNT), m_right(NODES_COUNT), m_up(NODES_COUNT),
+      m_down(NODES_COUNT), m_column(NODES_COUNT), m_row(NODES_COUNT, -1),
+      m_size(1 + CONSTRAINTS_COUNT, 0), m_first(CANDIDATES_COUNT),
+      m_covered(1 + CONSTRAINTS_COUNT, false), m_stack(CELLS_COUNT),
+      m_depth{0}, m_solution{0}, m_solutions{0}, m_limit{1} {
+   // Link the root and the column headers in a circular list.
+   for (int header{0}; header <= CONSTRAINTS_COUNT; ++header) {
+      m_left[header] = header == ROOT ? CONSTRAINTS_COUNT : header - 1;
+      m_right[header] = header == CONSTRAINTS_COUNT ? ROOT : header + 1;
+      m_up[header] = header;
+      m_down[header] = header;
+      m_column[header] = header;
+   }
+
+   int node{1 + CONSTRAINTS_COUNT};
+
+   for (int candidate{0}; candidate != CANDIDATES_COUNT; ++candidate) {
+      int cell{candidate / BOARD_SIZE};
+      int digit{candidate % BOARD_SIZE};
+      int row{cell / BOARD_SIZE};
+      int column{cell % BOARD_SIZE};
+
+      // Headers of the four constraints satisfied by this candidate.
+      int headers[NODES_PER_ROW]{
+          1 + cell,
+          1 + CELLS_COUNT + row * BOARD_SIZE + digit,
+          1 + 2 * CELLS_COUNT + column * BOARD_SIZE + digit,
+          1 + 3 * CELLS_COUNT + blockIndex(row, column) * BOARD_SIZE + digit};
+
+      m_first[candidate] = node;
+
+      for (int index{0}; index != NODES_PER_ROW; ++index) {
+         int header{headers[index]};
+
+         // Append the node at the bottom of its column.
+         m_column[node] = header;
+         m_row[node] = candidate;
+         m_up[node] = m_up[header];
+         m_down[node] = header;
+         m_down[m_up[header]] = node;
+         m_up[header] = node;
+         ++m_size[header];
+
+         // Link the node in the circular list of its candidate row.
+         m_left[node] = index == 0 ? node + NODES_PER_ROW - 1 : node - 1;
+         m_right[node] = index == NODES_PER_ROW - 1 ? node - index : node + 1;
+
+         ++node;
+      }
+   }
+}
+
+/// @brief Removes a column and the rows that use it from the matrix.
+/// @param column_ The column header.
+void DlxSolver::cover(int column_) {
+   m_covered[column_] = true;
+   m_right[m_left[column_]] = m_right[column_];
+   m_left[m_right[column_]] = m_left[column_];
+
+   for (int row{m_down[column_]}; row != column_; row = m_down[row]) {
+      for (int node{m_right[row]}; node != row; node = m_right[node]) {
+         m_down[m_up[node]] = m_down[node];
+         m_up[m_down[node]] = m_up[node];
+         --m_size[m_column[node]];
+      }
+   }
+}
+
+/// @brief Restores a column removed by cover(), in exact reverse order.
+/// @param column_ The column header.
+void DlxSolver::uncover(int column_) {
+   for (int row{m_up[column_]}; row != column_; row = m_up[row]) {
+      for (int node{m_left[row]}; node != row; node = m_left[node]) {
+         ++m_size[m_column[node]];
+         m_down[m_up[node]] = node;
+         m_up[m_down[node]] = node;
+      }
+   }
+
+   m_right[m_left[column_]] = column_;
+   m_left[m_right[column_]] = column_;
+   m_covered[column_] = false;
+}
+
+/// @brief Selects a candidate row, covering all of its columns.
+/// @param row_ The candidate to select.
+/// @return False if one of its constraints was already satisfied.
+bool DlxSolver::select(int row_) {
+   int first{m_first[row_]};
+
+   // Givens that share a constraint cannot be selected together.
+   for (int index{0}; index != NODES_PER_ROW; ++index) {
+      if (m_covered[m_column[first + index]]) {
+         return false;
+      }
+   }
+
+   for (int index{0}; index != NODES_PER_ROW; ++index) {
+      cover(m_column[first + index]);
+   }
+
+   m_stack[m_depth++] = row_;
+   return true;
+}
+
+/// @brief Undoes the selection of a candidate row.
+/// @param row_ The candidate to release.
+void DlxSolver::release(int row_) {
+   int first{m_first[row_]};
+
+   for (int index{NODES_PER_ROW - 1}; index >= 0; --index) {
+      uncover(m_column[first + index]);
+   }
+
+   --m_depth;
+}
+
+/// @brief Searches the exact covers of the remaining matrix.
+void DlxSolver::search() {
+   if (m_right[ROOT] == ROOT) {
+      // Every constraint is satisfied: record the first solution.
+      if (++m_solutions == 1) {
+         for (int index{0}; index != m_depth; ++index) {
+            int candidate{m_stack[index]};
+            m_solution[candidate / BOARD_SIZE] =
+                static_cast<unsigned char>(candidate % BOARD_SIZE + 1);
+         }
+      }
+      return;
+   }
+
+   // Branch on the constraint with the fewest candidates.
+   int column{m_right[ROOT]};
+   for (int header{m_right[column]}; header != ROOT;
+        header = m_right[header]) {
+      if (m_size[header] < m_size[column]) {
+         column = header;
+      }
+   }
+
+   if (m_size[column] == 0) {
+      return;
+   }
+
+   cover(column);
+
+   for (int row{m_down[column]}; row != column; row = m_down[row]) {
+      m_stack[m_depth++] = m_row[row];
+
+      for (int node{m_right[row]}; node != row; node = m_right[node]) {
+         cover(m_column[node]);
+      }
+
+      search();
+
+      for (int node{m_left[row]}; node != row; node = m_left[node]) {
+         uncover(m_column[node]);
+      }
+
+      --m_depth;
+
+      if (m_solutions >= m_limit) {
+         break;
+      }
+   }
+
+   uncover(column);
+}
+
+/// @brief Runs a search from a board.
+/// @param board_ The board to solve.
+/// @param limit_ Number of solutions that stops the search.
+void DlxSolver::run(Board const &board_, int limit_) {
+   m_solutions = 0;
+   m_limit = limit_ > 0 ? limit_ : 1;
+   m_depth = 0;
+
+   bool consistent{true};
+
+   // Select the rows of the givens.
+   for (int cell{0}; cell != CELLS_COUNT && consistent; ++cell) {
+      int value{board_.m_values[cell / BOARD_SIZE][cell % BOARD_SIZE]};
+
+      if (value > BOARD_SIZE) {
+         consistent = false;
+      } else if (value > 0) {
+         consistent = select(cell * BOARD_SIZE + value - 1);
+      }
+   }
+
+   if (consistent) {
+      search();
+   }
+
+   // Release the givens so the matrix is ready for the next board.
+   while (m_depth != 0) {
+      release(m_stack[m_depth - 1]);
+   }
+}
+
+/// @brief Solves a board.
+/// @param board_ The board to solve; positive values are givens.
+/// @return A pair indicating success (true/false) and the solved board, where
+/// givens stay positive and solved cells hold the negated digit.
+std::pair<bool, Board> DlxSolver::solve(Board const &board_) {
+   run(board_, 1);
+
+   if (m_solutions == 0) {
+      return {false, board_};
+   }
+
+   return {true, buildSolution(board_, m_solution)};
+}
+
+/// @brief Counts the solutions of a board.
+/// @param board_ The board to inspect; positive values are givens.
+/// @param limit_ Number of solutions that stops the count.
+/// @param solution_ If not null, receives the first solution found.
+/// @return The number of solutions, capped at the limit.
+int DlxSolver::countSolutions(Board const &board_, int limit_,
+                              Board *solution_) {
+   run(board_, limit_);
+
+   if (solution_ != nullptr && m_solutions != 0) {
+      *solution_ = buildSolution(board_, m_solution);
+   }
+
+   return m_solutions;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file DlxSolver.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares a Sudoku solver based on Dancing Links (DLX).
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Sudoku is encoded as an exact cover problem with 324 constraints (each cell
+ * filled once, each digit once per row, column and block) and 729 candidate
+ * rows (one per cell and digit). Knuth's Algorithm X walks the sparse matrix
+ * with the Dancing Links technique, always branching on the constraint with
+ * the fewest candidates left.
+ *
+ * The node arena is built once by the constructor. A solve selects the rows
+ * of the givens, searches, and undoes every selection in reverse order, so
+ * the matrix is back to its initial state and nothing is allocated between
+ * solves.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef DLX_SOLVER_HPP_
+#define DLX_SOLVER_HPP_
+
+#include "Solver.hpp"
+#include <vector>
+
+/**
+ * @class DlxSolver
+ * @brief Solves Sudoku boards with Dancing Links exact cover search.
+ *
+ * Steadier than plain backtracking on sparse boards (such as 17-clue
+ * puzzles), where propagation alone gives little guidance.
+ */
+class DlxSolver : public Solver {
+ private:
+   std::vector<int> m_left;     ///< Left neighbour of each node.
+   std::vector<int> m_right;    ///< Right neighbour of each node.
+   std::vector<int> m_up;       ///< Upper neighbour of each node.
+   std::vector<int> m_down;     ///< Lower neighbour of each node.
+   std::vector<int> m_column;   ///< Column header of each node.
+   std::vector<int> m_row;      ///< Candidate (cell * 9 + digit - 1) of a node.
+   std::vector<int> m_size;     ///< Number of nodes left in each column.
+   std::vector<int> m_first;    ///< First node of each candidate row.
+   std::vector<bool> m_covered; ///< Whether each column is covered.
+
+   std::vector<int> m_stack;              ///< Candidates currently selected.
+   int m_depth;                           ///< Number of selected candidates.
+   unsigned char m_solution[CELLS_COUNT]; ///< Digits of the first solution.
+   int m_solutions; ///< Number of solutions found by the last search.
+   int m_limit;     ///< Number of solutions that stops the search.
+
+   /**
+    * @brief Removes a column and the rows that use it from the matrix.
+    * @param column_ The column header.
+    */
+   void cover(int column_);
+
+   /**
+    * @brief Restores a column removed by cover().
+    * @param column_ The column header.
+    */
+   void uncover(int column_);
+
+   /**
+    * @brief Selects a candidate row, covering all of its columns.
+    * @param row_ The candidate to select.
+    * @return False if one of its constraints was already satisfied.
+    */
+   bool select(int row_);
+
+   /**
+    * @brief Undoes the selection of a candidate row.
+    * @param row_ The candidate to release.
+    */
+   void release(int row_);
+
+   /**
+    * @brief Searches the exact covers of the remaining matrix.
+    */
+   void search();
+
+   /**
+    * @brief Runs a search from a board.
+    * @param board_ The board to solve.
+    * @param limit_ Number of solutions that stops the search.
+    */
+   void run(Board const &board_, int limit_);
+
+ public:
+   /**
+    * @brief Constructor for the DlxSolver class; builds the node arena.
+    */
+   DlxSolver();
+
+   /**
+    * @brief Solves a board.
+    * @param board_ The board to solve; positive values are givens.
+    * @return A pair indicating success (true/false) and the solved board.
+    */
+   std::pair<bool, Board> solve(Board const &board_) override;
+
+   /**
+    * @brief Counts the solutions of a board.
+    * @param board_ The board to inspect; positive values are givens.
+    * @param limit_ Number of solutions that stops the count (default 2, enough
+    * to tell unique boards apart).
+    * @param solution_ If not null, receives the first solution found, in the
+    * encoding of solve(); left untouched when there is none.
+    * @return The number of solutions, capped at the limit.
+    */
+   int countSolutions(Board const &board_, int limit_ = 2,
+                      Board *solution_ = nullptr) override;
+};
+
+#endif /// DLX_SOLVER_HPP_
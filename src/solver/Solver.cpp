@@ -0,0 +1,44 @@
+/**
+ * @file Solver.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the helpers shared by the solving engines.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "Solver.hpp"
+#include "BitmaskSolver.hpp"
+#include "DlxSolver.hpp"
+
+/// @brief Builds a solution board from the digits of every cell.
+/// @param board_ The board that was solved.
+/// @param cells_ The digit of every cell, in row-major order.
+/// @return The board with the givens kept and the solved cells negated.
+Board Solver::buildSolution(Board const &board_, unsigned char const *cells_) {
+   Board solution{board_};
+
+   for (int cell{0}; cell != CELLS_COUNT; ++cell) {
+      int &value{solution.m_values[cell / BOARD_SIZE][cell % BOARD_SIZE]};
+
+      if (value <= 0) {
+         value = -cells_[cell];
+      }
+   }
+
+   return solution;
+}
+
+/// @brief Creates a solving engine by name.
+/// @param engine_ The engine name.
+/// @return The engine, or nullptr if the name is unknown.
+std::unique_ptr<Solver> makeSolver(std::string const &engine_) {
+   if (engine_ == ENGINE_BITMASK) {
+      return std::make_unique<BitmaskSolver>();
+   } else if (engine_ == ENGINE_DLX) {
+      return std::make_unique<DlxSolver>();
+   }
+
+   return nullptr;
+}
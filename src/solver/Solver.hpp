@@ -0,0 +1,80 @@
+/**
+ * @file Solver.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Declares the common interface of the Sudoku solving engines.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Every engine takes a `Board` whose positive values are the givens and
+ * returns the solution in the encoding used by the banks: givens keep their
+ * positive value and solved cells store the negated digit. Engines keep
+ * internal buffers between calls, so an instance must not be shared between
+ * threads.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SOLVER_HPP_
+#define SOLVER_HPP_
+
+#include "Sudoku.hpp"
+#include <memory>
+#include <string>
+#include <utility>
+
+/// Name of the bitmask backtracking engine.
+std::string const ENGINE_BITMASK{"bitmask"};
+
+/// Name of the Dancing Links engine.
+std::string const ENGINE_DLX{"dlx"};
+
+/**
+ * @class Solver
+ * @brief Base class of the Sudoku solving engines.
+ */
+class Solver {
+ protected:
+   /**
+    * @brief Builds a solution board from the digits of every cell.
+    * @param board_ The board that was solved.
+    * @param cells_ The digit of every cell, in row-major order.
+    * @return The board with the solved cells stored as negative values.
+    */
+   static Board buildSolution(Board const &board_,
+                              unsigned char const *cells_);
+
+ public:
+   /**
+    * @brief Virtual destructor for the Solver class.
+    */
+   virtual ~Solver() = default;
+
+   /**
+    * @brief Solves a board.
+    * @param board_ The board to solve; positive values are givens.
+    * @return A pair indicating success (true/false) and the solved board.
+    */
+   virtual std::pair<bool, Board> solve(Board const &board_) = 0;
+
+   /**
+    * @brief Counts the solutions of a board.
+    * @param board_ The board to inspect; positive values are givens.
+    * @param limit_ Number of solutions that stops the count (default 2, enough
+    * to tell unique boards apart).
+    * @param solution_ If not null, receives the first solution found, in the
+    * encoding of solve(); left untouched when there is none.
+    * @return The number of solutions, capped at the limit.
+    */
+   virtual int countSolutions(Board const &board_, int limit_ = 2,
+                              Board *solution_ = nullptr) = 0;
+};
+
+/**
+ * @brief Creates a solving engine by name.
+ * @param engine_ The engine name (ENGINE_BITMASK or ENGINE_DLX).
+ * @return The engine, or nullptr if the name is unknown.
+ */
+std::unique_ptr<Solver> makeSolver(std::string const &engine_);
+
+#endif /// SOLVER_HPP_
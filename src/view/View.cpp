@@ -16,12 +16,39 @@
 #include <iostream>
 #include <sstream>
 
+/// Style of the title and of the menu options.
+constexpr ext::Style const HEADING_STYLE{ext::cfg::blue, ext::cbg::none,
+                                         ext::stl::bold};
+
+/// Style of the prompts.
+constexpr ext::Style const PROMPT_STYLE{ext::cfg::blue, ext::cbg::none,
+                                        ext::stl::italic};
+
+/// Style of the information lines.
+constexpr ext::Style const INFO_STYLE{ext::cfg::green, ext::cbg::none,
+                                      ext::stl::italic};
+
+/// Style of the command syntax.
+constexpr ext::Style const COMMANDS_STYLE{ext::cfg::green, ext::cbg::none,
+                                          ext::stl::bold};
+
+/// Style of the game status lines.
+constexpr ext::Style const STATUS_STYLE{ext::cfg::yellow, ext::cbg::none,
+                                        ext::stl::italic};
+
+/// Style of the message to the player.
+constexpr ext::Style const MESSAGE_STYLE{ext::cfg::none, ext::cbg::yellow,
+                                         ext::stl::italic};
+
+/// Style of the message at the end of a game.
+constexpr ext::Style const ENDING_STYLE{ext::cfg::red, ext::cbg::none,
+                                        ext::stl::bold};
+
 /// @brief Renders the title of the Sudoku game on the console.
 void renderTitle() {
    // Create a horizontal line of '=' characters.
    ext::fstring bars{WIDTH, '='};
-   bars.color(ext::cfg::blue); // Set the text color to blue.
-   bars.style(ext::stl::bold); // Apply bold style to the text.
+   bars.apply(HEADING_STYLE); // Set the text to blue and bold.
 
    // Construct the title string with version information.
    std::ostringstream oss;
@@ -29,14 +56,12 @@ void renderTitle() {
        << "." << sudoku_VERSION_MINOR << "";
    ext::fstring title{oss.str()};
    title.align_center(WIDTH);
-   title.color(ext::cfg::blue);
-   title.style(ext::stl::bold);
+   title.apply(HEADING_STYLE);
 
    // Create the copyright notice.
    ext::fstring copyright{"Copyright (C) 2023, Pedro Lucas M. Nascimento"};
    copyright.align_center(WIDTH);
-   copyright.color(ext::cfg::blue);
-   copyright.style(ext::stl::bold);
+   copyright.apply(HEADING_STYLE);
 
    // Output the title and copyright on the console.
    std::cout << bars << "\n";
@@ -51,10 +76,14 @@ void renderHelper(int default_checks_) {
    renderTitle(); // Render the title first.
 
    // Output usage information and game options.
-   std::cout << "Usage: sudoku [-c <num>] [-h] <input_puzzle_file>\n";
+   std::cout << "Usage: sudoku [-c <num>] [-a] [-d] [-h] <input_puzzle_file>\n";
    std::cout << "  Game options:\n";
    std::cout << "    -c <num> Number of checks per game. Default = "
              << default_checks_ << ".\n";
+   std::cout << "    -a       Save the game in the background after every "
+                "move, to save/autosave.sav.\n";
+   std::cout << "    -d       Keep the screen and redraw only what changed "
+                "(terminals only).\n";
    std::cout << "    -h       Print this help text.\n";
 }
 
@@ -67,8 +96,7 @@ void renderSelectData(std::vector<std::string> const &datas_) {
 
    // Create an information message for data selection.
    ext::fstring info{"Select one of the options below."};
-   info.color(ext::cfg::green);
-   info.style(ext::stl::italic);
+   info.apply(INFO_STYLE);
 
    std::cout << info << "\n"; // Output the information message.
 
@@ -79,8 +107,7 @@ void renderSelectData(std::vector<std::string> const &datas_) {
 
    // Create a message to prompt user input.
    ext::fstring select{"Enter one of the listed game banks >> "};
-   select.color(ext::cfg::blue);
-   select.style(ext::stl::italic);
+   select.apply(PROMPT_STYLE);
 
    std::cout << "\n" << select; // Output the prompt for user input.
 }
@@ -113,8 +140,7 @@ void renderMenu(const std::function<void()> &draw_function_, bool save_,
              : "Load"; // Display "Save" or "Load" based on the save_ parameter.
    options += "  4. About  5. Quit";
 
-   options.color(ext::cfg::blue);
-   options.style(ext::stl::bold);
+   options.apply(HEADING_STYLE);
 
    ext::fstring request{"Select option [1,5] >> "};
    request.color(ext::cfg::blue);
@@ -141,8 +167,7 @@ void renderPlay(const std::function<void()> &draw_function_, int checks_left_,
 
    // Create and output the "Checks left" information.
    ext::fstring checks{"Checks left: [ " + std::to_string(checks_left_) + " ]"};
-   checks.color(ext::cfg::yellow);
-   checks.style(ext::stl::italic);
+   checks.apply(STATUS_STYLE);
 
    std::cout << checks << "\n";
 
@@ -158,23 +183,19 @@ void renderPlay(const std::function<void()> &draw_function_, int checks_left_,
    }
 
    digits += "]";
-   digits.color(ext::cfg::yellow);
-   digits.style(ext::stl::italic);
+   digits.apply(STATUS_STYLE);
 
    std::cout << digits << "\n";
 
    // Create and output the player message.
    ext::fstring message_left{"MSG: ["};
-   message_left.color(ext::cfg::yellow);
-   message_left.style(ext::stl::italic);
+   message_left.apply(STATUS_STYLE);
 
    ext::fstring message{message_};
-   message.background(ext::cbg::yellow);
-   message.style(ext::stl::italic);
+   message.apply(MESSAGE_STYLE);
 
    ext::fstring message_right{"]"};
-   message_right.color(ext::cfg::yellow);
-   message_right.style(ext::stl::italic);
+   message_right.apply(STATUS_STYLE);
 
    std::cout << message_left << message << message_right << "\n\n";
 
@@ -190,18 +211,20 @@ void renderPlay(const std::function<void()> &draw_function_, int checks_left_,
        "  'c' 'enter'                        -> check which moves are "
        "correct.\n"
        "  'u' + 'enter'                      -> undo the last play.\n"
+       "  'd' + 'enter'                      -> redo the last undone play.\n"
+       "  'b' + 'enter'                      -> switch the last play to another "
+       "branch.\n"
        "  <col> and <number> must be in the range [1,9].\n"
-       "  <row> must be in the range [A,I].\n"};
+       "  <row> must be in the range [A,I].\n"
+       "  Several commands may be entered on one line, separated by ';'.\n"};
 
-   commands.color(ext::cfg::green);
-   commands.style(ext::stl::bold);
+   commands.apply(COMMANDS_STYLE);
 
    std::cout << commands << "\n";
 
    // Create and output the prompt for user action.
    ext::fstring enter_command{"Enter the action >> "};
-   enter_command.color(ext::cfg::blue);
-   enter_command.style(ext::stl::italic);
+   enter_command.apply(PROMPT_STYLE);
 
    std::cout << enter_command;
 }
@@ -224,8 +247,7 @@ void renderWinner(const std::function<void()> &draw_function_, int checks_left_,
 
    // Create and output the "Checks left" information.
    ext::fstring checks{"Checks left: [ " + std::to_string(checks_left_) + " ]"};
-   checks.color(ext::cfg::yellow);
-   checks.style(ext::stl::italic);
+   checks.apply(STATUS_STYLE);
 
    std::cout << checks << "\n";
 
@@ -241,15 +263,13 @@ void renderWinner(const std::function<void()> &draw_function_, int checks_left_,
    }
 
    digits += "]";
-   digits.color(ext::cfg::yellow);
-   digits.style(ext::stl::italic);
+   digits.apply(STATUS_STYLE);
 
    std::cout << digits << "\n";
 
    // Create and output the player message.
    ext::fstring message_left{"MSG: ["};
-   message_left.color(ext::cfg::yellow);
-   message_left.style(ext::stl::italic);
+   message_left.apply(STATUS_STYLE);
 
    ext::fstring message;
 
@@ -260,12 +280,10 @@ void renderWinner(const std::function<void()> &draw_function_, int checks_left_,
       message = "Sorry, you lost! Press enter to continue.";
    }
 
-   message.background(ext::cbg::yellow);
-   message.style(ext::stl::italic);
+   message.apply(MESSAGE_STYLE);
 
    ext::fstring message_right{"]"};
-   message_right.color(ext::cfg::yellow);
-   message_right.style(ext::stl::italic);
+   message_right.apply(STATUS_STYLE);
 
    std::cout << message_left << message << message_right << "\n\n";
 }
@@ -276,8 +294,7 @@ void renderNewGame(bool save_) {
    // Create a prompt message asking if the player wants to start a new game.
    ext::fstring ask{"You have a game in progress. Are you sure you want to "
                     "load a new game [y/N]? "};
-   ask.color(ext::cfg::blue);
-   ask.style(ext::stl::italic);
+   ask.apply(PROMPT_STYLE);
 
    // Output the prompt only if there is a game in progress (save_ is true).
    if (save_) {
@@ -296,8 +313,7 @@ void renderLoadSave(std::vector<std::pair<std::string, Save>> const &saves_) {
 
    // Create an information message indicating the options.
    ext::fstring info{"Select one of the options below or enter your own save."};
-   info.color(ext::cfg::green);
-   info.style(ext::stl::italic);
+   info.apply(INFO_STYLE);
 
    // Output the information message.
    std::cout << info << "\n";
@@ -312,8 +328,7 @@ void renderLoadSave(std::vector<std::pair<std::string, Save>> const &saves_) {
 
    // Create a prompt to enter a selected game save.
    ext::fstring select{"Enter one of the listed game saves >> "};
-   select.color(ext::cfg::blue);
-   select.style(ext::stl::italic);
+   select.apply(PROMPT_STYLE);
 
    // Output the prompt.
    std::cout << "\n" << select;
@@ -323,8 +338,7 @@ void renderLoadSave(std::vector<std::pair<std::string, Save>> const &saves_) {
 void renderRequestSave() {
    // Create a prompt message for the user to enter the save file name.
    ext::fstring select{"Enter the save file >> "};
-   select.color(ext::cfg::blue);
-   select.style(ext::stl::italic);
+   select.apply(PROMPT_STYLE);
 
    // Output the prompt to the console.
    std::cout << "\n" << select;
@@ -335,8 +349,7 @@ void renderOverwriteConfirm() {
    // Create a confirmation prompt for overwriting an existing file.
    ext::fstring select{"This file already exists, are you sure you want to "
                        "overwrite it [y/N]? "};
-   select.color(ext::cfg::blue);
-   select.style(ext::stl::italic);
+   select.apply(PROMPT_STYLE);
 
    // Output the confirmation prompt to the console.
    std::cout << "\n" << select;
@@ -351,8 +364,7 @@ void renderAbout() {
 
    // Create a line of dashes with a specified width.
    ext::fstring bars{WIDTH, '-'};
-   bars.color(ext::cfg::green);
-   bars.style(ext::stl::italic);
+   bars.apply(INFO_STYLE);
 
    // Output the line of dashes.
    std::cout << bars << "\n";
@@ -375,8 +387,7 @@ void renderAbout() {
       do {
          ext::fstring buffer{line.split_at(WIDTH, ' ')};
 
-         line.color(ext::cfg::green);
-         line.style(ext::stl::italic);
+         line.apply(INFO_STYLE);
 
          // Output the formatted line.
          std::cout << line << "\n";
@@ -389,8 +400,7 @@ void renderAbout() {
    std::cout << bars << "\n";
 
    ext::fstring end{"Press <enter> to go back."};
-   end.color(ext::cfg::blue);
-   end.style(ext::stl::italic);
+   end.apply(PROMPT_STYLE);
 
    std::cout << "\n" << end;
 }
@@ -400,8 +410,7 @@ void renderAbout() {
 void renderQuitting(bool save_) {
    ext::fstring ask{
        "You have a game in progress. Are you sure you want to leave [y/N]? "};
-   ask.color(ext::cfg::blue);
-   ask.style(ext::stl::italic);
+   ask.apply(PROMPT_STYLE);
 
    // If save_ is true, the game is in progress, and the confirmation message is
    // displayed.
@@ -423,8 +432,7 @@ void renderEnding(std::string warning_) {
    // Create an fstring to display the warning message with red text and bold
    // formatting.
    ext::fstring message{warning_};
-   message.color(ext::cfg::red);
-   message.style(ext::stl::bold);
+   message.apply(ENDING_STYLE);
 
    // Display the warning message to the user.
    std::cout << message << "\n";